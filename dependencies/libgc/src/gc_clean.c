@@ -0,0 +1,30 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_clean.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 02:21:44 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 02:21:44 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libgc.h"
+
+/* Frees every tracked block and the table; gc_init may be called again */
+void	gc_clean(void)
+{
+	t_gc_context	*gc;
+	size_t			i;
+
+	gc = gc_get_context();
+	if (!gc)
+		return ;
+	i = 0;
+	while (i < gc->capacity)
+		free(gc->pointers[i++]);
+	free(gc->pointers);
+	free(gc);
+	*gc_get_context_ptr() = NULL;
+}
@@ -0,0 +1,46 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_context.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 02:21:44 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 02:21:44 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libgc.h"
+
+t_gc_context	**gc_get_context_ptr(void)
+{
+	static t_gc_context	*gc;
+
+	return (&gc);
+}
+
+t_gc_context	*gc_get_context(void)
+{
+	return (*gc_get_context_ptr());
+}
+
+int	gc_init(void)
+{
+	t_gc_context	*gc;
+
+	if (gc_get_context())
+		return (0);
+	gc = malloc(sizeof(t_gc_context));
+	if (!gc)
+		return (-1);
+	gc->pointers = calloc(GC_INITIAL_CAPACITY, sizeof(void *));
+	if (!gc->pointers)
+	{
+		free(gc);
+		return (-1);
+	}
+	gc->count = 0;
+	gc->capacity = GC_INITIAL_CAPACITY;
+	*gc_get_context_ptr() = gc;
+	return (0);
+}
@@ -0,0 +1,46 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_malloc.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 02:21:44 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 02:21:44 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libgc.h"
+
+void	*gc_malloc(size_t size)
+{
+	void	*ptr;
+
+	if (!gc_get_context() && gc_init() != 0)
+		return (NULL);
+	ptr = malloc(size);
+	if (!ptr)
+		return (NULL);
+	if (gc_track_pointer(ptr) != 0)
+	{
+		free(ptr);
+		return (NULL);
+	}
+	return (ptr);
+}
+
+/* Frees ptr if it is tracked; -1 leaves an unknown pointer alone */
+int	gc_free(void *ptr)
+{
+	if (!ptr || gc_untrack_pointer(ptr) != 0)
+		return (-1);
+	free(ptr);
+	return (0);
+}
+
+size_t	gc_count(void)
+{
+	if (!gc_get_context())
+		return (0);
+	return (gc_get_context()->count);
+}
@@ -0,0 +1,61 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_resize.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 02:21:44 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 02:21:44 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libgc.h"
+
+/* Rehashes every live entry into a table GC_GROWTH_FACTOR times larger */
+int	gc_resize(t_gc_context *gc)
+{
+	void	**table;
+	size_t	capacity;
+	size_t	i;
+	size_t	j;
+
+	capacity = gc->capacity * GC_GROWTH_FACTOR;
+	table = calloc(capacity, sizeof(void *));
+	if (!table)
+		return (-1);
+	i = 0;
+	while (i < gc->capacity)
+	{
+		if (gc->pointers[i])
+		{
+			j = gc_hash(gc->pointers[i], capacity);
+			while (table[j])
+				j = (j + 1) & (capacity - 1);
+			table[j] = gc->pointers[i];
+		}
+		i++;
+	}
+	free(gc->pointers);
+	gc->pointers = table;
+	gc->capacity = capacity;
+	return (0);
+}
+
+void	*ft_realloc(void *ptr, size_t old_size, size_t new_size)
+{
+	unsigned char	*dst;
+	size_t			i;
+
+	dst = malloc(new_size);
+	if (!dst)
+		return (NULL);
+	i = 0;
+	while (ptr && i < old_size && i < new_size)
+	{
+		dst[i] = ((unsigned char *)ptr)[i];
+		i++;
+	}
+	free(ptr);
+	return (dst);
+}
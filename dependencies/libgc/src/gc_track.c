@@ -0,0 +1,100 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_track.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 02:21:44 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 02:21:44 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libgc.h"
+
+/*
+** Blocks are at least 16-byte aligned, so the low bits carry nothing.
+** The multiply spreads neighbouring addresses over the whole table.
+*/
+size_t	gc_hash(void *ptr, size_t capacity)
+{
+	unsigned long	h;
+
+	h = ((unsigned long)ptr >> 4) * 0x9E3779B97F4A7C15UL;
+	return ((h ^ (h >> 32)) & (capacity - 1));
+}
+
+/* Slot holding ptr, or capacity if it is not tracked */
+static size_t	gc_find(t_gc_context *gc, void *ptr)
+{
+	size_t	i;
+
+	i = gc_hash(ptr, gc->capacity);
+	while (gc->pointers[i] && gc->pointers[i] != ptr)
+		i = (i + 1) & (gc->capacity - 1);
+	if (!gc->pointers[i])
+		return (gc->capacity);
+	return (i);
+}
+
+int	gc_track_pointer(void *ptr)
+{
+	t_gc_context	*gc;
+	size_t			i;
+
+	gc = gc_get_context();
+	if (!gc)
+		return (-1);
+	if ((gc->count + 1) * 2 > gc->capacity && gc_resize(gc) != 0)
+		return (-1);
+	i = gc_hash(ptr, gc->capacity);
+	while (gc->pointers[i] && gc->pointers[i] != ptr)
+		i = (i + 1) & (gc->capacity - 1);
+	if (!gc->pointers[i])
+		gc->count++;
+	gc->pointers[i] = ptr;
+	return (0);
+}
+
+/*
+** Backward-shift deletion: entries after the hole that would no longer be
+** reachable from their home slot move into it, so no tombstones pile up
+** and probe runs stay as short as the load factor allows.
+*/
+static void	gc_close_hole(t_gc_context *gc, size_t hole)
+{
+	size_t	mask;
+	size_t	i;
+	size_t	home;
+
+	mask = gc->capacity - 1;
+	i = (hole + 1) & mask;
+	while (gc->pointers[i])
+	{
+		home = gc_hash(gc->pointers[i], gc->capacity);
+		if (((i - home) & mask) >= ((i - hole) & mask))
+		{
+			gc->pointers[hole] = gc->pointers[i];
+			gc->pointers[i] = NULL;
+			hole = i;
+		}
+		i = (i + 1) & mask;
+	}
+}
+
+int	gc_untrack_pointer(void *ptr)
+{
+	t_gc_context	*gc;
+	size_t			i;
+
+	gc = gc_get_context();
+	if (!gc)
+		return (-1);
+	i = gc_find(gc, ptr);
+	if (i == gc->capacity)
+		return (-1);
+	gc->pointers[i] = NULL;
+	gc->count--;
+	gc_close_hole(gc, i);
+	return (0);
+}
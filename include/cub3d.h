@@ -6,7 +6,7 @@
 /*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/28 15:31:41 by ataher            #+#    #+#             */
-/*   Updated: 2025/12/27 00:15:19 by ataher           ###   ########.fr       */
+/*   Updated: 2026/10/19 02:51:40 by ataher           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -19,7 +19,12 @@
 # include "libftsscanf.h"
 # include "libgc.h"
 # include "libgnl.h"
+# include "stats_shm.h"
+# include "frame_shm.h"
+# include "cub3d_api.h"
 # include <limits.h>
+# include <pthread.h>
+# include <stdio.h>
 # include <sys/time.h>
 
 # define WIDTH 1800
@@ -31,12 +36,143 @@
 # define FOV_RAD 1.047197551
 /* PLANE_DIST = (TAN(FOV / 2)) */
 # define PLANE_DIST 0.57735
+/* Walls closer than this are drawn as if at this distance */
+# define MIN_WALL_DIST 0.0001
 
 /* FPS and timing */
 # define TARGET_FPS 60
-# define FRAME_TIME_US 16666
+# define PACER_SPIN_US 500
+/* --low-latency: slack kept between the predicted frame work and deadline */
+# define PACER_LATE_MARGIN_US 1000
 # define MOVE_SPEED 3.0
 # define ROT_SPEED 2.0
+# define SIM_TICK_RATE 120
+# define SIM_MAX_FRAME 0.25
+# define SIM_MAX_STEPS 8
+
+/* Input event queue and input-to-present latency histogram */
+# define INPUT_QUEUE_SIZE 256
+# define LATENCY_BUCKETS 100
+# define LATENCY_BUCKET_US 500
+
+/* Performance HUD */
+# define HUD_HISTORY 240
+# define HUD_GLYPH_W 5
+# define HUD_GLYPH_H 7
+# define HUD_SCALE 2
+# define HUD_CHARSET "0123456789. ADEFHIMNPRSTUY"
+# define HUD_CHARSET_LEN 26
+# define HUD_WIDTH 260
+# define HUD_HEIGHT 216
+# define HUD_LINE_H 18
+# define HUD_GRAPH_H 60
+# define HUD_GRAPH_MS 33.3
+# define HUD_SMOOTHING 0.1
+# define HUD_COLOR_TEXT 0xFFFFFF
+# define HUD_COLOR_GOOD 0x30C050
+# define HUD_COLOR_SLOW 0xE04040
+# define HUD_COLOR_TARGET 0xFFD700
+
+/* Longest engine log line, see log_line */
+# define LOG_LINE_MAX 512
+
+/* Hardware counters sampled per render stage with --perf */
+# define PERF_COUNTERS 5
+
+/* Render statistics: threads counting at once, a full batch plus ours */
+# define STATS_MAX_THREADS 72
+
+/* Trace-event timeline, built with make TRACE=1 */
+# define TRACE_RING_SIZE 16384
+# define TRACE_MAX_THREADS 16
+# define TRACE_MAX_DEPTH 32
+# define TRACE_DEFAULT_PATH "cub3d_trace.json"
+
+# ifdef CUB3D_TRACE
+#  define TRACE_INIT(path) trace_init(path)
+#  define TRACE_THREAD(name) trace_thread(name)
+#  define TRACE_FRAME(frame) trace_frame(frame)
+#  define TRACE_BEGIN(name) trace_begin(name)
+#  define TRACE_END() trace_end()
+#  define TRACE_DUMP() trace_dump()
+#  define TRACE_SHUTDOWN() trace_shutdown()
+# else
+#  define TRACE_INIT(path) ((void)0)
+#  define TRACE_THREAD(name) ((void)0)
+#  define TRACE_FRAME(frame) ((void)0)
+#  define TRACE_BEGIN(name) ((void)0)
+#  define TRACE_END() ((void)0)
+#  define TRACE_DUMP() ((void)0)
+#  define TRACE_SHUTDOWN() ((void)0)
+# endif
+
+/* Input recording / replay */
+# define REPLAY_MAGIC 0x52425543
+# define REPLAY_VERSION 1
+
+/* Key bits of a replay mask, see keys_to_mask */
+# define REPLAY_KEY_W CUB3D_KEY_W
+# define REPLAY_KEY_A CUB3D_KEY_A
+# define REPLAY_KEY_S CUB3D_KEY_S
+# define REPLAY_KEY_D CUB3D_KEY_D
+# define REPLAY_KEY_LEFT CUB3D_KEY_LEFT
+# define REPLAY_KEY_RIGHT CUB3D_KEY_RIGHT
+
+/* World snapshots, see world_snapshot */
+# define SNAPSHOT_MAGIC 0x50414E53
+# define SNAPSHOT_VERSION 1
+
+/* Decoded texture cache */
+# define TEXCACHE_DIR ".texcache"
+# define TEXCACHE_EXT ".tex"
+# define TEXCACHE_MAGIC 0x58455443
+# define TEXCACHE_VERSION 2
+# define TEXCACHE_BGRA 0
+# define TEXCACHE_INDEXED 1
+# define TEXCACHE_PATH_MAX 256
+# define TEXCACHE_NAME_MAX 64
+# define XPM_MAX_CPP 8
+# define XPM_NAME_MAX 32
+/*
+** Texture manager: handle count, loader threads (one per wall face, so
+** the startup walls decode side by side), default byte budget,
+** placeholder size
+*/
+# define TEXMGR_MAX_SLOTS 64
+# define TEXMGR_LOADERS 4
+# define TEXMGR_DEFAULT_BUDGET 67108864
+# define TEXMGR_PLACEHOLDER_SIZE 16
+# define TEXMGR_FALLBACK_COLOR 0x808080
+/* Textures with at most this many colors are stored as 8-bit indices */
+# define TEX_PALETTE_SIZE 256
+/* Copied texture data and placeholder cells start on a 64-byte boundary */
+# define TEXTURE_ALIGN 64
+
+/* Bump arenas: allocation alignment and parse chunk size */
+# define ARENA_ALIGN 16
+# define PARSE_ARENA_CHUNK 65536
+
+/* Frame capture: default buffer pool, output chunk, RLE stream header */
+# define CAPTURE_BUFFERS 8
+# define CAPTURE_CHUNK 65536
+# define CAPTURE_PATH_MAX 4096
+# define CAPTURE_STREAM "capture.rle"
+# define CAPTURE_MAGIC 0x454C5243
+# define CAPTURE_VERSION 1
+
+/* Command line */
+# define OPTIONS_USAGE "Usage: ./cub3D [options] <map.cub>"
+
+/* Display backend; HEADLESS=1 builds drop MLX and X11 entirely */
+# define HEADLESS_FRAMES 100
+
+/* Upper bound on threads render_batch spreads a batch over */
+# define RENDER_MAX_THREADS 64
+# ifdef CUB3D_HEADLESS
+#  define PLATFORM_DEFAULT platform_headless
+# else
+#  define PLATFORM_DEFAULT platform_mlx
+# endif
 
 /* Minimap settings */
 # define MINIMAP_SCALE 15
@@ -57,6 +193,9 @@
 # define KEY_D 100
 # define KEY_LEFT 65361
 # define KEY_RIGHT 65363
+# define KEY_TAB 65289
+# define KEY_T 116
+# define KEY_M 109
 
 /* Map tile types */
 # define WALL '1'
@@ -128,10 +267,71 @@ typedef struct s_keys
 
 typedef struct s_time
 {
+	long	start;
 	long	last_frame;
 	double	delta_time;
+	long	frame_count;
 }	t_time;
 
+/*
+** Fixed-timestep simulation: whole ticks are consumed from accumulator,
+** the leftover fraction interpolates the camera between prev and player.
+*/
+typedef struct s_sim
+{
+	double		tick;
+	double		accumulator;
+	double		alpha;
+	long		ticks;
+	t_player	prev;
+}	t_sim;
+
+/*
+** Frame pacer: absolute monotonic deadlines, period 0 means uncapped.
+** Present-to-present intervals are accumulated for the jitter report.
+*/
+typedef struct s_pacer
+{
+	long	period;
+	long	deadline;
+	long	last_present;
+	long	frames;
+	long	missed;
+	long	min;
+	long	max;
+	double	sum;
+	double	sum_sq;
+	long	wake;
+	long	work;
+}	t_pacer;
+
+/* A key transition, stamped when MLX dispatched it to the hook */
+typedef struct s_input_event
+{
+	long	time;
+	int		keycode;
+	int		pressed;
+}	t_input_event;
+
+/*
+** Single-producer single-consumer ring: the key hooks push, the frame
+** loop drains before the update. The stamps of drained events stay
+** pending until the next present closes their latency.
+*/
+typedef struct s_input
+{
+	t_input_event	events[INPUT_QUEUE_SIZE];
+	unsigned int	head;
+	unsigned int	tail;
+	long			dropped;
+	long			pending[INPUT_QUEUE_SIZE];
+	int				pending_count;
+	long			count;
+	long			sum;
+	long			max;
+	long			hist[LATENCY_BUCKETS];
+}	t_input;
+
 typedef struct s_image
 {
 	void	*img;
@@ -141,13 +341,424 @@ typedef struct s_image
 	int		endian;
 }	t_image;
 
+/*
+** Decoded image, either mapped from the cache or decoded on the heap.
+** Images with at most TEX_PALETTE_SIZE colors are kept as 8-bit indices
+** into palette (colors > 0), the others as BGRA pixels in img.
+*/
+typedef struct s_tex_source
+{
+	t_image			img;
+	unsigned char	*indices;
+	unsigned int	*palette;
+	int				colors;
+	int				width;
+	int				height;
+	void			*cache_map;
+	size_t			cache_len;
+	void			*heap;
+}	t_tex_source;
+
+/*
+** Texture as seen by the renderer. Either pixels is set, or indices with
+** a palette and its side-shaded copy.
+*/
 typedef struct s_texture
 {
-	t_image	img;
-	int		width;
-	int		height;
+	unsigned int	*pixels;
+	unsigned char	*indices;
+	unsigned int	*palette;
+	unsigned int	*shaded;
+	int				width;
+	int				height;
 }	t_texture;
 
+/* One TEXMGR_PLACEHOLDER_SIZE square cell per handle, in one allocation */
+typedef struct s_tex_pool
+{
+	unsigned char	*data;
+	size_t			size;
+}	t_tex_pool;
+
+typedef enum e_slot_state
+{
+	SLOT_UNLOADED,
+	SLOT_QUEUED,
+	SLOT_RESIDENT,
+	SLOT_FAILED,
+	SLOT_BROKEN
+}	t_slot_state;
+
+/*
+** A texture handle is an index into slots. The full-resolution data comes
+** and goes with the budget, the placeholder stays once it has been made.
+** It lives in data for a decoded XPM, or in the cache mapping map for a
+** cache hit (data then only holds an indexed texture's palettes). bytes
+** covers both. state and has_placeholder are published by the loaders.
+** Pinned slots (the wall faces) are never evicted.
+*/
+typedef struct s_tex_slot
+{
+	char		*path;
+	t_texture	texture;
+	t_texture	placeholder;
+	void		*data;
+	void		*map;
+	size_t		map_len;
+	size_t		bytes;
+	long		last_used;
+	int			state;
+	int			has_placeholder;
+	int			pinned;
+}	t_tex_slot;
+
+typedef struct s_texmgr
+{
+	t_tex_slot		slots[TEXMGR_MAX_SLOTS];
+	int				count;
+	int				queue[TEXMGR_MAX_SLOTS];
+	int				head;
+	int				tail;
+	pthread_mutex_t	lock;
+	pthread_cond_t	wake;
+	pthread_cond_t	done;
+	pthread_t		loaders[TEXMGR_LOADERS];
+	int				running;
+	int				quit;
+	size_t			budget;
+	size_t			resident;
+	size_t			pinned;
+	long			frame;
+	t_tex_pool		placeholders;
+	unsigned int	fallback_pixel;
+	t_texture		fallback;
+}	t_texmgr;
+
+/* A closed span, written as a Chrome trace "X" event */
+typedef struct s_trace_event
+{
+	const char	*name;
+	long		start;
+	long		dur;
+	long		frame;
+}	t_trace_event;
+
+/*
+** Single-producer single-consumer ring owned by one thread: the owner
+** publishes head, whoever dumps the trace consumes up to it and
+** publishes tail. Open spans live on a small per-thread stack.
+*/
+typedef struct s_trace_ring
+{
+	t_trace_event	events[TRACE_RING_SIZE];
+	unsigned long	head;
+	unsigned long	tail;
+	unsigned long	dropped;
+	const char		*name;
+	int				tid;
+	int				depth;
+	t_trace_event	open[TRACE_MAX_DEPTH];
+}	t_trace_ring;
+
+typedef struct s_tracer
+{
+	t_trace_ring	*rings[TRACE_MAX_THREADS];
+	int				count;
+	long			epoch;
+	long			frame;
+	char			*path;
+	FILE			*out;
+	int				written;
+	pthread_mutex_t	lock;
+}	t_tracer;
+
+/* Key state packed one bit per t_keys field, stamped by simulation tick */
+typedef struct s_key_event
+{
+	unsigned int	tick;
+	unsigned int	keys;
+}	t_key_event;
+
+typedef struct s_replay_header
+{
+	unsigned int	magic;
+	unsigned int	version;
+	int				tick_rate;
+	unsigned int	keys;
+	t_player		player;
+	long			ticks;
+	long			events;
+}	t_replay_header;
+
+typedef enum e_replay_mode
+{
+	REPLAY_OFF,
+	REPLAY_RECORD,
+	REPLAY_PLAY
+}	t_replay_mode;
+
+typedef struct s_replay
+{
+	int				mode;
+	t_replay_header	header;
+	t_key_event		*events;
+	long			capacity;
+	long			next;
+	unsigned int	keys;
+	long			*frame_us;
+	long			*stage_us;
+	long			frames;
+	unsigned long	run_hash;
+}	t_replay;
+
+/*
+** Everything a world changes while it runs. The map, textures and options
+** are loaded once and never written, so this is all a reset or a
+** checkpoint needs. The map size guards against restoring into another
+** map; the struct is stored as is, like a replay header.
+*/
+typedef struct s_snapshot
+{
+	unsigned int	magic;
+	unsigned int	version;
+	int				map_width;
+	int				map_height;
+	unsigned int	keys;
+	t_player		player;
+	t_player		camera;
+	t_sim			sim;
+	t_time			time;
+}	t_snapshot;
+
+/* One step of a scripted fly-through: hold keys for ms milliseconds */
+typedef struct s_path_step
+{
+	unsigned int	keys;
+	int				ms;
+}	t_path_step;
+
+/* Order statistics of a timing series, in microseconds */
+typedef struct s_timing_summary
+{
+	long	count;
+	double	mean;
+	long	min;
+	long	p50;
+	long	p95;
+	long	p99;
+	long	max;
+}	t_timing_summary;
+
+/* Start/end stamps of a timed stage, in get_time_us() microseconds */
+typedef struct s_stage_time
+{
+	long	start;
+	long	end;
+	int		status;
+}	t_stage_time;
+
+/* Per-frame render stages timed for the HUD, see render_frame */
+typedef enum e_frame_stage
+{
+	FRAME_RENDER_3D,
+	FRAME_MINIMAP,
+	FRAME_RAYS,
+	FRAME_PRESENT,
+	FRAME_HUD,
+	FRAME_STAGE_COUNT
+}	t_frame_stage;
+
+/*
+** Performance overlay. Glyphs are rasterized once at HUD_SCALE into
+** on/off masks; stage times are smoothed so the digits stay readable.
+*/
+typedef struct s_hud
+{
+	int				visible;
+	float			history[HUD_HISTORY];
+	int				head;
+	double			frame_ms;
+	double			stage_ms[FRAME_STAGE_COUNT];
+	t_stage_time	stages[FRAME_STAGE_COUNT];
+	unsigned char	glyphs[HUD_CHARSET_LEN][HUD_GLYPH_H * HUD_SCALE]
+	[HUD_GLYPH_W * HUD_SCALE];
+}	t_hud;
+
+/*
+** perf_event_open counters for the main thread, opened as one group so a
+** single read() samples them all. slot maps each counter to its position
+** in the group read, -1 when the kernel refused it.
+*/
+typedef struct s_perf
+{
+	int				enabled;
+	int				leader;
+	int				fds[PERF_COUNTERS];
+	int				slot[PERF_COUNTERS];
+	int				nr;
+	unsigned long	start[PERF_COUNTERS + 2];
+	unsigned long	totals[FRAME_STAGE_COUNT][PERF_COUNTERS];
+	long			samples[FRAME_STAGE_COUNT];
+	long			multiplexed;
+}	t_perf;
+
+/*
+** Counters are bumped by their owning thread only; the publisher sums
+** every block plus what exited threads left in retired, once per frame.
+** Blocks are reused by later threads and freed by stats_close.
+*/
+typedef struct s_stats_block
+{
+	unsigned long	values[STAT_COUNT];
+	int				owned;
+}	t_stats_block;
+
+typedef struct s_stats
+{
+	t_stats_block	*blocks[STATS_MAX_THREADS];
+	unsigned long	retired[STAT_COUNT];
+	unsigned long	previous[STAT_COUNT];
+	pthread_mutex_t	lock;
+	pthread_key_t	key;
+	t_stats_page	*page;
+}	t_stats;
+
+/* Where log_line sends engine messages, set through cub3d_set_log */
+typedef struct s_log_sink
+{
+	t_cub3d_log	fn;
+	void		*user;
+	int			quiet;
+}	t_log_sink;
+
+/* Owner subsystem of a tracked allocation, see memory.c */
+typedef enum e_mem_tag
+{
+	MEM_PARSER,
+	MEM_MAP,
+	MEM_TEXTURES,
+	MEM_RENDER,
+	MEM_TAG_COUNT
+}	t_mem_tag;
+
+/* Live bytes and blocks, the high-water mark and lifetime allocations */
+typedef struct s_mem_usage
+{
+	long	bytes;
+	long	count;
+	long	peak;
+	long	allocs;
+}	t_mem_usage;
+
+/* Arena memory block, its payload follows the header */
+typedef struct s_arena_chunk
+{
+	struct s_arena_chunk	*next;
+	size_t					size;
+	size_t					used;
+}	t_arena_chunk;
+
+/*
+** Bump-pointer allocator: allocations are never freed one by one, the
+** whole arena is released at once. bytes and blocks tally, per tag,
+** what mem_alloc accounted from it, so the release balances them. Not
+** thread-safe.
+*/
+typedef struct s_arena
+{
+	t_arena_chunk	*head;
+	size_t			chunk_size;
+	long			bytes[MEM_TAG_COUNT];
+	long			blocks[MEM_TAG_COUNT];
+}	t_arena;
+
+/* Runtime settings from the command line */
+typedef struct s_options
+{
+	char	*map_path;
+	size_t	texture_budget;
+	int		target_fps;
+	int		tick_rate;
+	char	*record_path;
+	char	*replay_path;
+	char	*timings_path;
+	char	*path_name;
+	char	*report_path;
+	int		show_hud;
+	char	*trace_path;
+	int		perf;
+	int		stats;
+	int		low_latency;
+	int		headless;
+	int		frames;
+	int		frame_ring;
+	char	*capture_dir;
+	int		capture_format;
+	int		capture_buffers;
+}	t_options;
+
+struct	s_game;
+
+/*
+** Display backend. Renderers only ever write game->img; a backend owns
+** that buffer and decides what presenting and running the loop mean.
+*/
+typedef struct s_platform
+{
+	const char	*name;
+	int			(*open)(struct s_game *game);
+	void		(*present)(struct s_game *game);
+	void		(*run)(struct s_game *game);
+	void		(*close)(struct s_game *game);
+}	t_platform;
+
+/* One column of textured wall being drawn */
+typedef struct s_stripe
+{
+	t_texture	*texture;
+	int			x;
+	int			tex_x;
+	double		step;
+	double		pos;
+}	t_stripe;
+
+/* XPM decoder state, the color table is an open-addressing hash */
+typedef struct s_xpm
+{
+	char			*data;
+	char			*cursor;
+	int				width;
+	int				height;
+	int				ncolors;
+	int				cpp;
+	unsigned long	*keys;
+	int				*slots;
+	unsigned int	*palette;
+	unsigned long	mask;
+}	t_xpm;
+
+/* An X11 color name, lowercased without blanks, and its 0xRRGGBB value */
+typedef struct s_color_name
+{
+	const char		*name;
+	unsigned int	color;
+}	t_color_name;
+
+/* On-disk decoded texture cache: header followed by BGRA or index rows */
+typedef struct s_texcache_header
+{
+	unsigned int	magic;
+	unsigned int	version;
+	int				width;
+	int				height;
+	long			src_mtime;
+	long			src_mtime_ns;
+	long			src_size;
+	int				format;
+	int				colors;
+	char			path[TEXCACHE_PATH_MAX];
+}	t_texcache_header;
+
 typedef struct s_ray
 {
 	double	camera_x;
@@ -169,18 +780,164 @@ typedef struct s_ray
 	int		draw_end;
 }	t_ray;
 
+typedef enum e_capture_format
+{
+	CAPTURE_RAW,
+	CAPTURE_PPM,
+	CAPTURE_RLE
+}	t_capture_format;
+
+/* One preallocated capture buffer, packed WIDTH x HEIGHT pixels */
+typedef struct s_capture_frame
+{
+	unsigned int	*pixels;
+	long			frame;
+	long			time_us;
+}	t_capture_frame;
+
+/* Buffered writes of the capture thread; written counts bytes on disk */
+typedef struct s_capture_out
+{
+	int				fd;
+	size_t			len;
+	unsigned long	written;
+	unsigned char	buf[CAPTURE_CHUNK];
+}	t_capture_out;
+
+/* Start of a CAPTURE_STREAM file, followed by one record per frame */
+typedef struct s_capture_header
+{
+	unsigned int	magic;
+	unsigned int	version;
+	int				width;
+	int				height;
+}	t_capture_header;
+
+/*
+** Frame capture: the render thread fills frames[tail % count] and the
+** writer thread drains frames[head % count]. Only the render thread moves
+** tail and only the writer moves head; lock and wake are just for waking
+** the writer. peak is the deepest the queue got, dropped the frames that
+** found every buffer still queued.
+*/
+typedef struct s_capture
+{
+	t_capture_frame	*frames;
+	int				count;
+	int				format;
+	char			*dir;
+	int				stream;
+	long			head;
+	long			tail;
+	pthread_mutex_t	lock;
+	pthread_cond_t	wake;
+	pthread_t		writer;
+	int				running;
+	int				quit;
+	t_capture_out	*out;
+	long			dropped;
+	long			peak;
+	long			failed;
+	long			write_us;
+}	t_capture;
+
 typedef struct s_game
 {
 	void		*mlx;
 	void		*win;
+	t_platform	*platform;
 	t_config	config;
 	t_player	player;
+	t_player	camera;
 	t_image		img;
 	t_keys		keys;
+	t_input		input;
 	t_time		time;
-	t_texture	textures[4];
+	t_pacer		pacer;
+	t_sim		sim;
+	t_replay	replay;
+	t_hud		hud;
+	t_perf		perf;
+	t_ring_page	*ring;
+	t_capture	capture;
+	t_options	options;
+	t_texmgr	texmgr;
+	t_arena		map_arena;
+	int			wall_tex[4];
 }	t_game;
 
+/*
+** Per-column by-products of a ray pass, each NULL to skip: the wall
+** distance along the view direction, the face hit (a t_direction) and the
+** map cell hit as an x, y pair. Column x goes to depth[x], face[x] and
+** tile[2 * x], tile[2 * x + 1].
+*/
+typedef struct s_aux
+{
+	float			*depth;
+	unsigned char	*face;
+	int				*tile;
+}	t_aux;
+
+/*
+** One ray pass: a camera, the image it draws into and the size drawn.
+** walls caches the face textures, NULL until a column first needs one.
+** aux, when set, also receives the column outputs.
+*/
+typedef struct s_view
+{
+	t_game		*game;
+	t_player	camera;
+	t_image		*img;
+	int			width;
+	int			height;
+	t_texture	*walls[4];
+	t_aux		*aux;
+}	t_view;
+
+/*
+** Caller-owned batch for render_batch: poses[i] is drawn into frames[i],
+** each width x height pixels. Frames need addr, line_length and
+** bits_per_pixel laid out like the window image. aux is NULL or holds
+** the column outputs of each frame.
+*/
+typedef struct s_batch
+{
+	const t_player	*poses;
+	t_image			*frames;
+	int				count;
+	int				width;
+	int				height;
+	t_aux			*aux;
+}	t_batch;
+
+/* Shared by the workers of one render_batch call; next is claimed */
+typedef struct s_batch_job
+{
+	t_batch	*batch;
+	t_view	view;
+	int		next;
+}	t_batch_job;
+
+/* Startup pipeline stages, see startup.c */
+typedef enum e_startup_stage
+{
+	STARTUP_CONFIG,
+	STARTUP_MAP,
+	STARTUP_DISPLAY,
+	STARTUP_TEXTURES,
+	STARTUP_COUNT
+}	t_startup_stage;
+
+typedef struct s_startup
+{
+	t_game			*game;
+	char			*path;
+	t_stage_time	stages[STARTUP_COUNT];
+	int				code;
+	const char		*error;
+}	t_startup;
+
 /* Config flags for validation */
 # define FLAG_NO 0x01
 # define FLAG_SO 0x02
@@ -193,10 +950,18 @@ typedef struct s_game
 /* Exit */
 void	ft_exit(int code, const char *message);
 
+/* Embedding API, see cub3d_api.h */
+int		api_fail(const char *message);
+t_log_sink	*log_sink(void);
+void	log_line(const char *format, ...);
+
 /* Parsing functions */
 void	print_config(t_config *config);
 void	print_map(char **grid, int height);
 int		parse_config_file(t_config *config, char *path);
+int		parse_config_header(t_config *config, char *path);
+int		parse_config_map(t_config *config, char *path);
+const char	*parse_error(int status);
 int		parse_config_line(t_config *config, const char *line);
 
 /* Texture parsing functions */
@@ -227,17 +992,45 @@ int		is_map_line(const char *line);
 int		get_line_length(const char *line);
 int		store_map_line(t_config *config, char *line, int idx);
 
+/* Startup functions */
+void	parse_options(t_options *options, int argc, char **argv);
+size_t	parse_size(const char *s);
+int		parse_count(const char *s);
+int		parse_capture_format(const char *s);
+void	run_startup(t_game *game, char *path);
+void	stage_begin(t_stage_time *stage);
+void	stage_end(t_stage_time *stage);
+void	log_startup(t_startup *startup, long t0);
+void	log_first_frame(t_game *game);
+
 /* Game/MLX functions */
-void	init_mlx(t_game *game);
+int		init_mlx(t_game *game);
 int		close_window(void *game);
 int		handle_keypress(int keycode, void *game);
 int		handle_keyrelease(int keycode, void *game);
 int		game_loop(void *game);
 
+/* Platform functions */
+t_platform	*platform_select(t_options *options);
+t_platform	*platform_mlx(void);
+t_platform	*platform_headless(void);
+unsigned long	frame_hash(t_image *img);
+
+/* Input queue and latency functions */
+int		input_push(t_input *input, int keycode, int pressed);
+void	input_drain(t_game *game);
+void	input_presented(t_input *input, long now);
+void	input_report(t_input *input);
+
 /* Timing functions */
 long	get_time_us(void);
 void	update_delta_time(t_game *game);
 void	cap_framerate(t_game *game);
+void	pacer_wait(long deadline);
+void	pacer_wait_late(t_game *game);
+void	pacer_init(t_pacer *pacer, int fps);
+void	pacer_record(t_pacer *pacer, long now);
+void	pacer_report(t_pacer *pacer);
 
 /* Player functions */
 void	init_player(t_game *game);
@@ -248,21 +1041,151 @@ void	strafe_left(t_game *game, double move_speed);
 void	strafe_right(t_game *game, double move_speed);
 void	rotate_left(t_game *game, double rot_speed);
 void	rotate_right(t_game *game, double rot_speed);
-void	process_movement(t_game *game);
+void	process_movement(t_game *game, double dt);
+void	sim_init(t_game *game, int tick_rate);
+void	sim_step(t_game *game);
+void	sim_advance(t_game *game);
+
+/* Render statistics functions */
+t_stats	*stats(void);
+void	stats_add(int stat, unsigned long n);
+void	stats_retire(void *arg);
+int		stats_open(void);
+void	stats_publish(t_game *game);
+void	stats_close(void);
+
+/* Shared-memory frame ring functions */
+int		frame_ring_open(t_game *game, int slots);
+void	frame_ring_publish(t_game *game);
+void	frame_ring_close(t_game *game);
+
+/* Frame capture functions */
+int		capture_open(t_game *game);
+void	capture_frame(t_game *game);
+void	capture_close(t_game *game);
+void	capture_queue(t_capture *cap);
+void	*capture_writer(void *arg);
+int		capture_flush(t_capture_out *out);
+int		capture_put(t_capture_out *out, const void *data, size_t len);
+void	capture_digits(char *dst, long n, int width);
+int		capture_ppm(t_capture_out *out, t_capture_frame *frame);
+int		capture_rle(t_capture_out *out, t_capture_frame *frame);
+
+/* Memory accounting functions */
+t_mem_usage	*mem_usage(int tag);
+void	mem_account(int tag, long bytes);
+void	*mem_alloc(int tag, size_t size);
+char	*mem_strdup(int tag, const char *s);
+char	*mem_next_line(int fd);
+void	mem_free_line(char *line);
+void	mem_release(int tag, long bytes, long blocks);
+void	mem_report(void);
+
+/* Arena functions */
+t_arena	*parse_arena(void);
+void	*arena_alloc(t_arena *arena, size_t size);
+char	*arena_strdup(t_arena *arena, const char *s);
+void	arena_account(t_arena *arena, int tag, long bytes);
+void	arena_destroy(t_arena *arena);
+void	arena_move(t_arena *dst, t_arena *src);
+
+/* Hardware counter functions */
+void	perf_init(t_perf *perf);
+void	perf_stage_begin(t_perf *perf);
+void	perf_stage_end(t_perf *perf, int stage);
+void	perf_report(t_perf *perf);
+void	perf_close(t_perf *perf);
+int		perf_read(t_perf *perf, unsigned long *out);
+
+/* Tracing functions, only compiled with make TRACE=1 */
+t_tracer		*tracer(void);
+t_trace_ring	*trace_ring(const char *name);
+void	trace_init(char *path);
+void	trace_thread(const char *name);
+void	trace_frame(long frame);
+void	trace_begin(const char *name);
+void	trace_end(void);
+void	trace_dump(void);
+void	trace_shutdown(void);
+
+/* Input recording / replay functions */
+void	replay_init(t_game *game);
+void	replay_tick(t_game *game);
+void	replay_frame(t_game *game, long work_us);
+void	replay_finish(t_game *game);
+unsigned int	keys_to_mask(t_keys *keys);
+void	mask_to_keys(unsigned int mask, t_keys *keys);
+int		replay_push(t_replay *replay, unsigned int tick, unsigned int keys);
+void	replay_report(t_game *game);
+int		replay_script(t_game *game, t_replay *replay, char *name);
+int		summarize_timings(long *values, long n, long stride,
+			t_timing_summary *out);
+int		replay_write_json(t_game *game, const char *path, unsigned long hash);
+
+/* World snapshot functions */
+void	world_snapshot(t_game *game, t_snapshot *snap);
+int		world_restore(t_game *game, const t_snapshot *snap);
+void	world_reset(t_game *game);
 
 /* Texture functions */
-void	load_textures(t_game *game);
+int		load_texture(t_tex_source *texture, char *path);
+void	unload_texture(t_tex_source *texture);
+int		register_wall_textures(t_game *game);
+int		wait_wall_textures(t_game *game);
+void	destroy_textures(t_game *game);
 int		get_texture_color(t_texture *texture, int x, int y);
+size_t	tex_entry_size(t_tex_source *source);
+void	tex_entry_fill(t_texture *dst, void *mem, t_tex_source *source);
+void	tex_placeholder_fill(t_texture *dst, void *mem, t_tex_source *source);
+
+/* Texture manager functions */
+int		texmgr_init(t_texmgr *mgr, size_t budget);
+int		texmgr_register(t_texmgr *mgr, const char *path, int pinned);
+t_texture	*texmgr_get(t_texmgr *mgr, int handle);
+void	texmgr_request(t_texmgr *mgr, int handle);
+int		texmgr_wait(t_texmgr *mgr, int handle);
+void	texmgr_update(t_texmgr *mgr);
+void	texmgr_destroy(t_texmgr *mgr);
+void	texmgr_release(t_texmgr *mgr, t_tex_slot *slot);
+void	*texmgr_loader(void *arg);
+int		texmgr_start(t_texmgr *mgr);
+void	texmgr_stop(t_texmgr *mgr);
+
+/* Texture cache functions */
+int		texcache_load(t_tex_source *texture, const char *path);
+int		texcache_store(t_tex_source *texture, const char *path);
+void	texcache_path(char *dst, const char *src);
+int		texcache_write_all(int fd, const void *buf, size_t len);
+int		texcache_write_pixels(int fd, t_tex_source *texture);
+size_t	texcache_payload_size(int format, int width, int height);
+
+/* XPM decoder functions */
+int		xpm_decode(t_tex_source *texture, const char *path);
+char	*xpm_read_file(const char *path, size_t *len);
+char	*xpm_next_string(t_xpm *xpm);
+unsigned long	xpm_key(const char *s, int cpp);
+void	xpm_insert(t_xpm *xpm, unsigned long key, int index);
+int		xpm_lookup(t_xpm *xpm, unsigned long key);
+int		xpm_color(const char *spec, unsigned int *color);
+int		xpm_color_name(const char *value, unsigned int *color);
 
 /* Raycasting functions */
-void	init_ray(t_game *game, t_ray *ray, int x);
-void	calculate_step_and_side_dist(t_game *game, t_ray *ray);
+void	init_ray(t_view *view, t_ray *ray, int x);
+void	calculate_step_and_side_dist(t_view *view, t_ray *ray);
 void	perform_dda(t_game *game, t_ray *ray);
-void	calculate_wall_distance(t_game *game, t_ray *ray);
+void	calculate_wall_distance(t_view *view, t_ray *ray);
 void	render_3d(t_game *game);
-void	draw_wall_stripe(t_game *game, t_ray *ray, int x);
+void	render_view(t_view *view);
+void	view_init(t_view *view, t_game *game, t_image *img);
+int		render_batch(t_game *game, t_batch *batch);
+void	draw_textured_wall(t_view *view, t_ray *ray, int x);
+void	draw_wall_stripe(t_view *view, t_ray *ray, int x);
+void	draw_stripe_truecolor(t_view *view, t_ray *ray, t_stripe *stripe);
+void	draw_stripe_palettized(t_view *view, t_ray *ray, t_stripe *stripe);
 int		calculate_tex_x(t_ray *ray, double wall_x, int tex_width);
-double	calculate_wall_x(t_game *game, t_ray *ray);
+double	calculate_wall_x(t_view *view, t_ray *ray);
+int		wall_face(t_ray *ray);
+void	store_aux(t_aux *aux, t_ray *ray, int x);
 
 /* Rendering functions */
 void	render_frame(t_game *game);
@@ -271,6 +1194,15 @@ void	draw_minimap_tile(t_game *game, int x, int y, int color);
 void	draw_minimap_player(t_game *game);
 void	draw_minimap_rays(t_game *game);
 void	my_mlx_pixel_put(t_image *img, int x, int y, int color);
+
+/* HUD functions */
+void	hud_init(t_hud *hud, int visible);
+void	hud_record(t_game *game);
+void	render_hud(t_game *game);
+void	hud_shade(t_image *img, int x, int y, int height);
+void	hud_graph(t_game *game, int x, int y);
+void	hud_text(t_game *game, const char *text, int x, int y);
+void	hud_format(char *buf, double value, int decimals);
 int		get_tile_color(t_game *game, int map_x, int map_y);
 void	get_camera_start(t_game *game, int *cam_start_x, int *cam_start_y);
 void	get_player_center(t_game *game, int *center_x, int *center_y);
@@ -0,0 +1,103 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cub3d_api.h                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:44:46 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 02:39:40 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef CUB3D_API_H
+# define CUB3D_API_H
+
+# include <stddef.h>
+
+/*
+** Embedding interface of libcub3d.a. It only depends on the C library,
+** so a host program includes this header alone. No call exits the
+** process: failures return NULL or -1 and cub3d_error() says why.
+** Calls on one world must not overlap; separate worlds are independent.
+*/
+
+/* Bits of the key mask given to cub3d_set_keys */
+# define CUB3D_KEY_W 1
+# define CUB3D_KEY_A 2
+# define CUB3D_KEY_S 4
+# define CUB3D_KEY_D 8
+# define CUB3D_KEY_LEFT 16
+# define CUB3D_KEY_RIGHT 32
+
+/* Wall faces written to t_cub3d_columns.face */
+# define CUB3D_FACE_NORTH 0
+# define CUB3D_FACE_SOUTH 1
+# define CUB3D_FACE_WEST 2
+# define CUB3D_FACE_EAST 3
+
+/*
+** Receives one engine log line at a time (texture loads, evictions and
+** failures), without the trailing newline. It may be called from a
+** world's texture loader threads.
+*/
+typedef void			(*t_cub3d_log)(const char *line, void *user);
+
+/* A loaded map with its textures, player and simulation */
+typedef struct s_game	t_cub3d;
+
+/* Camera position in map cells, view direction and camera plane */
+typedef struct s_cub3d_pose
+{
+	double	x;
+	double	y;
+	double	dir_x;
+	double	dir_y;
+	double	plane_x;
+	double	plane_y;
+}	t_cub3d_pose;
+
+/*
+** Caller-owned 0x00RRGGBB pixels, stride pixels apart row to row. Frames
+** may be up to the window size of the interactive game.
+*/
+typedef struct s_cub3d_frame
+{
+	unsigned int	*pixels;
+	int				width;
+	int				height;
+	int				stride;
+}	t_cub3d_frame;
+
+/*
+** Optional column outputs of cub3d_render_columns, any of them NULL to
+** skip: the wall distance of each column along the view direction in map
+** cells, the CUB3D_FACE_* it hit, and the map cell it hit as x, y pairs.
+** They hold width, width and 2 * width entries of the frame's width. The
+** wall covers height / depth rows centred on the middle row, ceiling
+** above, floor below.
+*/
+typedef struct s_cub3d_columns
+{
+	float			*depth;
+	unsigned char	*face;
+	int				*tile;
+}	t_cub3d_columns;
+
+t_cub3d		*cub3d_load(const char *map_path);
+int			cub3d_set_camera(t_cub3d *world, const t_cub3d_pose *pose);
+int			cub3d_get_camera(t_cub3d *world, t_cub3d_pose *pose);
+int			cub3d_set_keys(t_cub3d *world, unsigned int keys);
+int			cub3d_step(t_cub3d *world, int ticks);
+int			cub3d_render(t_cub3d *world, t_cub3d_frame *frame);
+int			cub3d_render_columns(t_cub3d *world, t_cub3d_frame *frame,
+				t_cub3d_columns *columns);
+int			cub3d_reset(t_cub3d *world);
+size_t		cub3d_snapshot_size(void);
+int			cub3d_snapshot(t_cub3d *world, void *buf, size_t size);
+int			cub3d_restore(t_cub3d *world, const void *buf, size_t size);
+void		cub3d_destroy(t_cub3d *world);
+const char	*cub3d_error(void);
+void		cub3d_set_log(t_cub3d_log fn, void *user);
+
+#endif
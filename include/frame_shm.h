@@ -0,0 +1,71 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   frame_shm.h                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:53:49 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 01:53:49 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef FRAME_SHM_H
+# define FRAME_SHM_H
+
+/*
+** Layout of the frame ring the engine publishes with --frame-ring N.
+** Shared by the engine and tools/cub3d_frames.c, so it only depends on
+** the C library.
+*/
+# define FRAME_SHM_NAME "/cub3d_frames"
+# define FRAME_SHM_MAGIC 0x4D524643
+# define FRAME_SHM_VERSION 1
+
+/*
+** Header of one slot, followed by height rows of stride bytes of
+** 0x00RRGGBB pixels. time_us is CLOCK_MONOTONIC when the frame was
+** finished; the pose is the camera it was drawn from.
+*/
+typedef struct s_ring_slot
+{
+	unsigned long	frame;
+	long			time_us;
+	double			x;
+	double			y;
+	double			dir_x;
+	double			dir_y;
+	double			plane_x;
+	double			plane_y;
+}	t_ring_slot;
+
+/*
+** Single-producer, single-consumer ring. The page is followed by slots
+** slots of slot_size bytes. head counts frames the engine published and
+** tail frames the consumer released; slot i % slots holds frame i. Only
+** the engine writes head, only the consumer writes tail, each on its own
+** cache line. A slot between tail and head belongs to the consumer, which
+** reads it in place. When head - tail reaches slots the engine skips the
+** frame and counts it in dropped instead of waiting.
+*/
+typedef struct s_ring_page
+{
+	unsigned int	magic;
+	unsigned int	version;
+	int				pid;
+	int				slots;
+	int				width;
+	int				height;
+	int				stride;
+	int				reserved;
+	unsigned long	slot_size;
+	unsigned long	offered;
+	unsigned long	dropped;
+	char			pad_meta[8];
+	unsigned long	head;
+	char			pad_head[56];
+	unsigned long	tail;
+	char			pad_tail[56];
+}	t_ring_page;
+
+#endif
@@ -6,7 +6,7 @@
 /*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/06/29 16:02:22 by ataher            #+#    #+#             */
-/*   Updated: 2025/11/22 19:39:39 by ataher           ###   ########.fr       */
+/*   Updated: 2026/10/19 02:21:48 by ataher           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -16,9 +16,16 @@
 # include <stddef.h>
 # include <stdlib.h>
 
+/* Table slots, a power of two; the table doubles past half full */
 # define GC_INITIAL_CAPACITY	16
 # define GC_GROWTH_FACTOR		2
 
+/*
+** Open-addressing hash set of live blocks: pointers has capacity slots,
+** NULL marks a free one, count is the number of tracked blocks. Lookups
+** probe linearly from the pointer's hash, so gc_free costs the same with
+** ten blocks tracked or a hundred thousand.
+*/
 typedef struct s_gc_context
 {
 	void	**pointers;
@@ -35,6 +42,7 @@ size_t			gc_count(void);
 /* Internal helper functions */
 t_gc_context	*gc_get_context(void);
 t_gc_context	**gc_get_context_ptr(void);
+size_t			gc_hash(void *ptr, size_t capacity);
 int				gc_resize(t_gc_context *gc);
 int				gc_track_pointer(void *ptr);
 int				gc_untrack_pointer(void *ptr);
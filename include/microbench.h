@@ -0,0 +1,75 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   microbench.h                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:27:14 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 01:50:17 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef MICROBENCH_H
+# define MICROBENCH_H
+
+# include "cub3d.h"
+
+/* Repetitions discarded before timing, then timed */
+# define BENCH_WARMUP 3
+# define BENCH_REPS 25
+/* Rays per perform_dda repetition, texels per get_texture_color one */
+# define BENCH_RAYS 65536
+# define BENCH_SAMPLES 262144
+/* Poses per render_batch call and their square frame size */
+# define BENCH_BATCH 256
+# define BENCH_BATCH_SIZE 128
+/* Bytes of column output per frame column: depth, tile x and y, face */
+# define BENCH_AUX_BYTES (sizeof(float) + 2 * sizeof(int) + 1)
+
+/* One benchmark row: each repetition processes units of unit */
+typedef struct s_bench
+{
+	const char	*kernel;
+	char		label[32];
+	const char	*unit;
+	long		units;
+}	t_bench;
+
+typedef void	(*t_bench_fn)(t_game *game, void *ctx);
+
+typedef struct s_ray_set
+{
+	t_ray	*rays;
+	long	count;
+}	t_ray_set;
+
+typedef struct s_wall_case
+{
+	t_view	view;
+	t_ray	ray;
+}	t_wall_case;
+
+typedef struct s_sample_set
+{
+	t_texture		*texture;
+	int				*xs;
+	int				*ys;
+	long			count;
+	unsigned int	sink;
+}	t_sample_set;
+
+void			bench_run(t_bench *bench, t_bench_fn fn, t_game *game,
+					void *ctx);
+unsigned long	bench_rand(unsigned long *state);
+int				bench_map(t_map *map, int size, int density);
+void			bench_free_map(t_map *map);
+void			bench_camera(t_game *game, unsigned long *state);
+int				bench_textures(t_game *game);
+void			bench_dda(t_game *game, int size, int density);
+void			bench_wall(t_game *game, int line_height);
+void			bench_texture(t_game *game, int pattern);
+void			bench_minimap_rays(t_game *game);
+void			bench_batch(t_game *game, int with_aux);
+
+#endif
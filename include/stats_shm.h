@@ -0,0 +1,54 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stats_shm.h                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:45:48 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 00:45:48 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef STATS_SHM_H
+# define STATS_SHM_H
+
+/*
+** Layout of the live statistics page the engine publishes with --stats.
+** Shared by the engine and tools/cub3d_stats.c, so it only depends on
+** the C library.
+*/
+# define STATS_SHM_NAME "/cub3d_stats"
+# define STATS_SHM_MAGIC 0x53544243
+# define STATS_SHM_VERSION 1
+
+typedef enum e_stat
+{
+	STAT_DDA_STEPS,
+	STAT_TEXELS,
+	STAT_PIXELS,
+	STAT_RAY_STEPS,
+	STAT_COUNT
+}	t_stat;
+
+/*
+** seq is a seqlock: odd while the engine is writing. Readers copy the
+** page and retry until they saw the same even value before and after.
+** last holds the counters of the most recent frame, total the sums since
+** startup.
+*/
+typedef struct s_stats_page
+{
+	unsigned int	magic;
+	unsigned int	version;
+	int				pid;
+	int				reserved;
+	unsigned long	seq;
+	unsigned long	frame;
+	unsigned long	last[STAT_COUNT];
+	unsigned long	total[STAT_COUNT];
+	double			frame_ms;
+	double			present_ms;
+}	t_stats_page;
+
+#endif
@@ -0,0 +1,56 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arena.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:51:39 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 02:24:43 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+static size_t	arena_align(size_t n)
+{
+	return ((n + ARENA_ALIGN - 1) & ~((size_t)ARENA_ALIGN - 1));
+}
+
+static t_arena_chunk	*arena_grow(t_arena *arena, size_t size)
+{
+	t_arena_chunk	*chunk;
+	size_t			bytes;
+
+	bytes = arena->chunk_size;
+	if (size > bytes)
+		bytes = size;
+	chunk = malloc(arena_align(sizeof(t_arena_chunk)) + bytes);
+	if (!chunk)
+		return (NULL);
+	chunk->next = arena->head;
+	chunk->size = bytes;
+	chunk->used = 0;
+	arena->head = chunk;
+	return (chunk);
+}
+
+/*
+** Requests larger than the chunk size get a chunk of their own. The tail
+** of the previous chunk is abandoned rather than searched.
+*/
+void	*arena_alloc(t_arena *arena, size_t size)
+{
+	t_arena_chunk	*chunk;
+	char			*ptr;
+
+	size = arena_align(size);
+	chunk = arena->head;
+	if (!chunk || chunk->size - chunk->used < size)
+		chunk = arena_grow(arena, size);
+	if (!chunk)
+		return (NULL);
+	ptr = (char *)chunk + arena_align(sizeof(t_arena_chunk)) + chunk->used;
+	chunk->used += size;
+	return (ptr);
+}
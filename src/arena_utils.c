@@ -0,0 +1,76 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arena_utils.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:51:39 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 02:26:18 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+/*
+** Home of the map grid, its rows and the texture paths. Only the startup
+** parser thread allocates from it and it is released as a whole at exit,
+** so nothing parsed is ever freed one allocation at a time. The contents
+** are accounted per request by mem_alloc, not per chunk, and released with
+** the arena.
+*/
+t_arena	*parse_arena(void)
+{
+	static t_arena	instance = {NULL, PARSE_ARENA_CHUNK, {0}, {0}};
+
+	return (&instance);
+}
+
+char	*arena_strdup(t_arena *arena, const char *s)
+{
+	char	*dup;
+	size_t	len;
+
+	len = ft_strlen(s) + 1;
+	dup = arena_alloc(arena, len);
+	if (dup)
+		ft_memcpy(dup, s, len);
+	return (dup);
+}
+
+/* Accounts an allocation from arena to tag until the arena is destroyed */
+void	arena_account(t_arena *arena, int tag, long bytes)
+{
+	mem_account(tag, bytes);
+	arena->bytes[tag] += bytes;
+	arena->blocks[tag]++;
+}
+
+void	arena_destroy(t_arena *arena)
+{
+	t_arena_chunk	*chunk;
+	int				tag;
+
+	tag = -1;
+	while (++tag < MEM_TAG_COUNT)
+	{
+		mem_release(tag, arena->bytes[tag], arena->blocks[tag]);
+		arena->bytes[tag] = 0;
+		arena->blocks[tag] = 0;
+	}
+	while (arena->head)
+	{
+		chunk = arena->head;
+		arena->head = chunk->next;
+		free(chunk);
+	}
+}
+
+/* Hands every chunk of src, and what they account, over to dst */
+void	arena_move(t_arena *dst, t_arena *src)
+{
+	*dst = *src;
+	src->head = NULL;
+	ft_memset(src->bytes, 0, sizeof(src->bytes));
+	ft_memset(src->blocks, 0, sizeof(src->blocks));
+}
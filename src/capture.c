@@ -0,0 +1,141 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   capture.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:58:22 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 02:00:01 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+
+/*
+** The whole pool is allocated and touched up front, so the render thread
+** never allocates or takes a first-use page fault while capturing.
+*/
+static int	capture_alloc(t_capture *cap)
+{
+	size_t	bytes;
+	int		i;
+
+	bytes = (size_t)WIDTH * HEIGHT * sizeof(unsigned int);
+	cap->frames = ft_calloc(cap->count, sizeof(t_capture_frame));
+	cap->out = ft_calloc(1, sizeof(t_capture_out));
+	if (!cap->frames || !cap->out)
+		return (-1);
+	i = -1;
+	while (++i < cap->count)
+	{
+		cap->frames[i].pixels = malloc(bytes);
+		if (!cap->frames[i].pixels)
+			return (-1);
+		ft_memset(cap->frames[i].pixels, 0, bytes);
+	}
+	mem_account(MEM_RENDER, (long)bytes * cap->count);
+	return (0);
+}
+
+/* The rle stream is one file for the session, opened with its header */
+static int	capture_stream(t_capture *cap)
+{
+	t_capture_header	header;
+	char				path[CAPTURE_PATH_MAX];
+
+	cap->stream = -1;
+	if (cap->format != CAPTURE_RLE)
+		return (0);
+	ft_strlcpy(path, cap->dir, CAPTURE_PATH_MAX);
+	ft_strlcat(path, "/" CAPTURE_STREAM, CAPTURE_PATH_MAX);
+	cap->stream = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	header = (t_capture_header){CAPTURE_MAGIC, CAPTURE_VERSION, WIDTH, HEIGHT};
+	if (cap->stream < 0
+		|| texcache_write_all(cap->stream, &header, sizeof(header)) < 0)
+		return (-1);
+	return (0);
+}
+
+int	capture_open(t_game *game)
+{
+	t_capture	*cap;
+
+	cap = &game->capture;
+	cap->dir = game->options.capture_dir;
+	cap->format = game->options.capture_format;
+	cap->count = game->options.capture_buffers;
+	if (mkdir(cap->dir, 0755) < 0 && errno != EEXIST)
+		return (-1);
+	if (capture_alloc(cap) < 0 || capture_stream(cap) < 0)
+		return (-1);
+	pthread_mutex_init(&cap->lock, NULL);
+	pthread_cond_init(&cap->wake, NULL);
+	if (pthread_create(&cap->writer, NULL, capture_writer, cap) != 0)
+		return (-1);
+	cap->running = 1;
+	return (0);
+}
+
+/*
+** Render side, once per presented frame: copies game->img into the next
+** free buffer and queues it. If every buffer is still waiting for the
+** disk the frame is dropped and counted; the render thread never waits.
+*/
+void	capture_frame(t_game *game)
+{
+	t_capture		*cap;
+	t_capture_frame	*frame;
+	long			depth;
+	int				y;
+
+	cap = &game->capture;
+	if (!cap->running)
+		return ;
+	depth = cap->tail - __atomic_load_n(&cap->head, __ATOMIC_ACQUIRE);
+	if (depth >= cap->count)
+	{
+		cap->dropped++;
+		return ;
+	}
+	frame = &cap->frames[cap->tail % cap->count];
+	frame->frame = game->time.frame_count;
+	frame->time_us = get_time_us();
+	y = -1;
+	while (++y < HEIGHT)
+		ft_memcpy(frame->pixels + (size_t)y * WIDTH, game->img.addr
+			+ (size_t)y * game->img.line_length, WIDTH * 4);
+	if (depth + 1 > cap->peak)
+		cap->peak = depth + 1;
+	capture_queue(cap);
+}
+
+/* Lets the writer finish the queue, then reports the back-pressure stats */
+void	capture_close(t_game *game)
+{
+	t_capture	*cap;
+
+	cap = &game->capture;
+	if (!cap->running)
+		return ;
+	pthread_mutex_lock(&cap->lock);
+	cap->quit = 1;
+	pthread_cond_signal(&cap->wake);
+	pthread_mutex_unlock(&cap->lock);
+	pthread_join(cap->writer, NULL);
+	cap->running = 0;
+	if (cap->stream >= 0)
+		close(cap->stream);
+	printf("[capture] %ld frames to %s, %ld dropped, %ld failed, peak queue "
+		"%ld/%d, %.1f MiB, %.3f ms/frame writing\n", cap->head, cap->dir,
+		cap->dropped, cap->failed, cap->peak, cap->count,
+		cap->out->written / 1048576.0, cap->write_us / 1000.0
+		/ (cap->head + (cap->head == 0)));
+	while (cap->count-- > 0)
+		free(cap->frames[cap->count].pixels);
+	free(cap->frames);
+	free(cap->out);
+}
@@ -0,0 +1,112 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   capture_format.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:58:22 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 01:58:22 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+int	capture_flush(t_capture_out *out)
+{
+	if (texcache_write_all(out->fd, out->buf, out->len) < 0)
+		return (-1);
+	out->written += out->len;
+	out->len = 0;
+	return (0);
+}
+
+/* Small pieces are gathered into CAPTURE_CHUNK writes, big ones go as is */
+int	capture_put(t_capture_out *out, const void *data, size_t len)
+{
+	if (out->len + len > CAPTURE_CHUNK && capture_flush(out) < 0)
+		return (-1);
+	if (len > CAPTURE_CHUNK)
+	{
+		if (texcache_write_all(out->fd, data, len) < 0)
+			return (-1);
+		out->written += len;
+		return (0);
+	}
+	ft_memcpy(out->buf + out->len, data, len);
+	out->len += len;
+	return (0);
+}
+
+/* Writes n in decimal, zero-padded to at least width digits */
+void	capture_digits(char *dst, long n, int width)
+{
+	char	digits[24];
+	int		len;
+
+	len = 0;
+	while ((n > 0 || len < width) && len < 20)
+	{
+		digits[len++] = '0' + n % 10;
+		n /= 10;
+	}
+	while (len > 0)
+		*dst++ = digits[--len];
+	*dst = '\0';
+}
+
+/* Binary PPM: an ASCII header, then the pixels as RGB triplets */
+int	capture_ppm(t_capture_out *out, t_capture_frame *frame)
+{
+	char			header[64];
+	unsigned int	pixel;
+	long			i;
+
+	ft_strlcpy(header, "P6\n", sizeof(header));
+	capture_digits(header + 3, WIDTH, 1);
+	ft_strlcat(header, " ", sizeof(header));
+	capture_digits(header + ft_strlen(header), HEIGHT, 1);
+	ft_strlcat(header, "\n255\n", sizeof(header));
+	if (capture_put(out, header, ft_strlen(header)) < 0)
+		return (-1);
+	i = 0;
+	while (i < (long)WIDTH * HEIGHT)
+	{
+		if (out->len + 3 > CAPTURE_CHUNK && capture_flush(out) < 0)
+			return (-1);
+		pixel = frame->pixels[i++];
+		out->buf[out->len++] = (pixel >> 16) & 0xFF;
+		out->buf[out->len++] = (pixel >> 8) & 0xFF;
+		out->buf[out->len++] = pixel & 0xFF;
+	}
+	return (0);
+}
+
+/*
+** One CAPTURE_STREAM record: frame number and time (two longs), then runs
+** of identical pixels as (count, pixel) pairs of unsigned ints until
+** WIDTH x HEIGHT pixels are covered. Flat ceilings and floors collapse to
+** a handful of runs per row.
+*/
+int	capture_rle(t_capture_out *out, t_capture_frame *frame)
+{
+	unsigned int	run[2];
+	long			i;
+
+	if (capture_put(out, &frame->frame, sizeof(long)) < 0
+		|| capture_put(out, &frame->time_us, sizeof(long)) < 0)
+		return (-1);
+	i = 0;
+	while (i < (long)WIDTH * HEIGHT)
+	{
+		run[0] = 1;
+		run[1] = frame->pixels[i];
+		while (i + run[0] < (long)WIDTH * HEIGHT
+			&& frame->pixels[i + run[0]] == run[1])
+			run[0]++;
+		if (capture_put(out, run, sizeof(run)) < 0)
+			return (-1);
+		i += run[0];
+	}
+	return (0);
+}
@@ -0,0 +1,106 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   capture_writer.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:58:22 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 02:00:01 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+#include <fcntl.h>
+
+/* Hands the buffer at tail, now filled, to the writer */
+void	capture_queue(t_capture *cap)
+{
+	pthread_mutex_lock(&cap->lock);
+	cap->tail++;
+	pthread_cond_signal(&cap->wake);
+	pthread_mutex_unlock(&cap->lock);
+}
+
+/* Waits for a queued frame; after quit, drains the queue then says NULL */
+static t_capture_frame	*capture_next(t_capture *cap)
+{
+	t_capture_frame	*frame;
+
+	pthread_mutex_lock(&cap->lock);
+	while (!cap->quit && cap->head == cap->tail)
+		pthread_cond_wait(&cap->wake, &cap->lock);
+	frame = NULL;
+	if (cap->head != cap->tail)
+		frame = &cap->frames[cap->head % cap->count];
+	pthread_mutex_unlock(&cap->lock);
+	return (frame);
+}
+
+/* dir/frame_00000042.ppm, or the shared stream for rle */
+static int	capture_file(t_capture *cap, t_capture_frame *frame)
+{
+	static const char	*ext[3] = {".raw", ".ppm", ".rle"};
+	char				path[CAPTURE_PATH_MAX];
+	size_t				len;
+
+	if (cap->format == CAPTURE_RLE)
+		return (cap->stream);
+	len = ft_strlcpy(path, cap->dir, CAPTURE_PATH_MAX - 32);
+	if (len >= CAPTURE_PATH_MAX - 32)
+		return (-1);
+	ft_strlcpy(path + len, "/frame_", 8);
+	capture_digits(path + len + 7, frame->frame, 8);
+	ft_strlcat(path, ext[cap->format], CAPTURE_PATH_MAX);
+	return (open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644));
+}
+
+static int	capture_write(t_capture *cap, t_capture_frame *frame)
+{
+	int	status;
+
+	cap->out->fd = capture_file(cap, frame);
+	if (cap->out->fd < 0)
+		return (-1);
+	cap->out->len = 0;
+	if (cap->format == CAPTURE_PPM)
+		status = capture_ppm(cap->out, frame);
+	else if (cap->format == CAPTURE_RLE)
+		status = capture_rle(cap->out, frame);
+	else
+		status = capture_put(cap->out, frame->pixels,
+				(size_t)WIDTH * HEIGHT * sizeof(unsigned int));
+	if (status == 0)
+		status = capture_flush(cap->out);
+	if (cap->format != CAPTURE_RLE)
+		close(cap->out->fd);
+	return (status);
+}
+
+/*
+** Writer thread: encodes and writes queued frames in order, so the frame
+** loop never waits on the disk. A buffer goes back to the render thread
+** only once head moves past it.
+*/
+void	*capture_writer(void *arg)
+{
+	t_capture		*cap;
+	t_capture_frame	*frame;
+	long			start;
+
+	cap = (t_capture *)arg;
+	TRACE_THREAD("capture writer");
+	frame = capture_next(cap);
+	while (frame)
+	{
+		start = get_time_us();
+		TRACE_BEGIN("capture_write");
+		if (capture_write(cap, frame) < 0)
+			cap->failed++;
+		TRACE_END();
+		cap->write_us += get_time_us() - start;
+		__atomic_store_n(&cap->head, cap->head + 1, __ATOMIC_RELEASE);
+		frame = capture_next(cap);
+	}
+	return (NULL);
+}
@@ -0,0 +1,82 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cub3d_api.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:44:46 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 01:44:46 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+static const char	**last_error(void)
+{
+	static __thread const char	*message;
+
+	return (&message);
+}
+
+/* Records why the current API call failed and returns -1 */
+int	api_fail(const char *message)
+{
+	*last_error() = message;
+	return (-1);
+}
+
+const char	*cub3d_error(void)
+{
+	return (*last_error());
+}
+
+/*
+** The frontend's startup without the display, the parser thread or
+** ft_exit: same steps, run in order, and every error is returned.
+*/
+static int	load_world(t_game *world, char *path)
+{
+	int	status;
+
+	world->options.texture_budget = TEXMGR_DEFAULT_BUDGET;
+	world->options.tick_rate = SIM_TICK_RATE;
+	if (texmgr_init(&world->texmgr, world->options.texture_budget) < 0)
+		return (api_fail("Failed to start texture loader"));
+	status = parse_config_header(&world->config, path);
+	if (status == 0 && register_wall_textures(world) < 0)
+		return (api_fail("Failed to register texture"));
+	if (status == 0)
+		status = parse_config_map(&world->config, path);
+	if (status < 0)
+		return (api_fail(parse_error(status)));
+	if (wait_wall_textures(world) < 0)
+		return (api_fail("Failed to load texture"));
+	init_player(world);
+	sim_init(world, world->options.tick_rate);
+	return (0);
+}
+
+/*
+** The parser allocates from the shared parse arena; a loaded world takes
+** those chunks along so each world frees exactly its own map. Loads must
+** not run concurrently with each other.
+*/
+t_cub3d	*cub3d_load(const char *map_path)
+{
+	t_game	*world;
+
+	if (!map_path)
+		return (api_fail("No map path"), NULL);
+	world = ft_calloc(1, sizeof(t_game));
+	if (!world)
+		return (api_fail("Out of memory"), NULL);
+	if (load_world(world, (char *)map_path) < 0)
+	{
+		arena_destroy(parse_arena());
+		cub3d_destroy(world);
+		return (NULL);
+	}
+	arena_move(&world->map_arena, parse_arena());
+	return (world);
+}
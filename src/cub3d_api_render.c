@@ -0,0 +1,50 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cub3d_api_render.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:44:46 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 02:27:34 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+/*
+** Draws the 3D view of the current camera straight into the caller's
+** pixels, through the same ray pass as the window. No minimap or HUD.
+** The column outputs, when given, are filled as the rays are cast.
+*/
+int	cub3d_render_columns(t_cub3d *world, t_cub3d_frame *frame,
+		t_cub3d_columns *columns)
+{
+	t_image	img;
+	t_view	view;
+	t_aux	aux;
+
+	if (!world || !frame || !frame->pixels)
+		return (api_fail("Invalid argument"));
+	if (frame->width <= 0 || frame->height <= 0 || frame->width > WIDTH
+		|| frame->height > HEIGHT || frame->stride < frame->width)
+		return (api_fail("Invalid frame size"));
+	img = (t_image){NULL, (char *)frame->pixels, 32,
+		frame->stride * (int)sizeof(unsigned int), 0};
+	view_init(&view, world, &img);
+	view.width = frame->width;
+	view.height = frame->height;
+	if (columns)
+	{
+		aux = (t_aux){columns->depth, columns->face, columns->tile};
+		if (aux.depth || aux.face || aux.tile)
+			view.aux = &aux;
+	}
+	render_view(&view);
+	return (0);
+}
+
+int	cub3d_render(t_cub3d *world, t_cub3d_frame *frame)
+{
+	return (cub3d_render_columns(world, frame, NULL));
+}
@@ -0,0 +1,60 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cub3d_api_state.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:46:50 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 01:46:50 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+/* Puts the player back on the map's spawn with no keys held */
+int	cub3d_reset(t_cub3d *world)
+{
+	if (!world)
+		return (api_fail("Invalid argument"));
+	world_reset(world);
+	return (0);
+}
+
+size_t	cub3d_snapshot_size(void)
+{
+	return (sizeof(t_snapshot));
+}
+
+/*
+** Copies the world's mutable state into buf, which needs
+** cub3d_snapshot_size() bytes. The bytes can be kept in memory or written
+** out as a checkpoint and restored into any world loaded from the same map
+** by the same build.
+*/
+int	cub3d_snapshot(t_cub3d *world, void *buf, size_t size)
+{
+	t_snapshot	snap;
+
+	if (!world || !buf)
+		return (api_fail("Invalid argument"));
+	if (size < sizeof(t_snapshot))
+		return (api_fail("Snapshot buffer too small"));
+	world_snapshot(world, &snap);
+	ft_memcpy(buf, &snap, sizeof(t_snapshot));
+	return (0);
+}
+
+int	cub3d_restore(t_cub3d *world, const void *buf, size_t size)
+{
+	t_snapshot	snap;
+
+	if (!world || !buf)
+		return (api_fail("Invalid argument"));
+	if (size < sizeof(t_snapshot))
+		return (api_fail("Truncated snapshot"));
+	ft_memcpy(&snap, buf, sizeof(t_snapshot));
+	if (world_restore(world, &snap) < 0)
+		return (api_fail("Snapshot is not from this map or version"));
+	return (0);
+}
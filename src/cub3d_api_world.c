@@ -0,0 +1,74 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cub3d_api_world.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:44:46 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 01:44:46 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+void	cub3d_destroy(t_cub3d *world)
+{
+	if (!world)
+		return ;
+	texmgr_destroy(&world->texmgr);
+	arena_destroy(&world->map_arena);
+	free(world);
+}
+
+/* Moves the player; the next step starts from the new pose */
+int	cub3d_set_camera(t_cub3d *world, const t_cub3d_pose *pose)
+{
+	if (!world || !pose)
+		return (api_fail("Invalid argument"));
+	world->player.x = pose->x;
+	world->player.y = pose->y;
+	world->player.dir_x = pose->dir_x;
+	world->player.dir_y = pose->dir_y;
+	world->player.plane_x = pose->plane_x;
+	world->player.plane_y = pose->plane_y;
+	world->sim.prev = world->player;
+	world->camera = world->player;
+	return (0);
+}
+
+int	cub3d_get_camera(t_cub3d *world, t_cub3d_pose *pose)
+{
+	if (!world || !pose)
+		return (api_fail("Invalid argument"));
+	pose->x = world->camera.x;
+	pose->y = world->camera.y;
+	pose->dir_x = world->camera.dir_x;
+	pose->dir_y = world->camera.dir_y;
+	pose->plane_x = world->camera.plane_x;
+	pose->plane_y = world->camera.plane_y;
+	return (0);
+}
+
+/* Held keys, CUB3D_KEY_* bits, applied by the following steps */
+int	cub3d_set_keys(t_cub3d *world, unsigned int keys)
+{
+	if (!world)
+		return (api_fail("Invalid argument"));
+	mask_to_keys(keys, &world->keys);
+	return (0);
+}
+
+/*
+** Runs ticks fixed simulation ticks of 1 / SIM_TICK_RATE seconds. The
+** camera is not interpolated: it shows the state after the last tick.
+*/
+int	cub3d_step(t_cub3d *world, int ticks)
+{
+	if (!world || ticks < 0)
+		return (api_fail("Invalid argument"));
+	while (ticks-- > 0)
+		sim_step(world);
+	world->camera = world->player;
+	return (0);
+}
@@ -0,0 +1,83 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   frame_pacer.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:35:00 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 01:04:18 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+#include <math.h>
+
+void	pacer_init(t_pacer *pacer, int fps)
+{
+	ft_memset(pacer, 0, sizeof(t_pacer));
+	if (fps > 0)
+		pacer->period = 1000000 / fps;
+	pacer->deadline = get_time_us() + pacer->period;
+	pacer->min = LONG_MAX;
+}
+
+void	pacer_record(t_pacer *pacer, long now)
+{
+	long	interval;
+
+	if (pacer->last_present)
+	{
+		interval = now - pacer->last_present;
+		pacer->frames++;
+		pacer->sum += interval;
+		pacer->sum_sq += (double)interval * interval;
+		if (interval < pacer->min)
+			pacer->min = interval;
+		if (interval > pacer->max)
+			pacer->max = interval;
+	}
+	pacer->last_present = now;
+}
+
+/*
+** --low-latency: sleeps before input is sampled instead of after the
+** present, leaving just enough time for the predicted update, render and
+** present to finish by the deadline.
+*/
+void	pacer_wait_late(t_game *game)
+{
+	t_pacer	*pacer;
+
+	if (!game->options.low_latency)
+		return ;
+	pacer = &game->pacer;
+	if (pacer->period > 0)
+		pacer_wait(pacer->deadline - pacer->work - PACER_LATE_MARGIN_US);
+	pacer->wake = get_time_us();
+}
+
+/*
+** Jitter is the standard deviation of the present-to-present interval.
+*/
+void	pacer_report(t_pacer *pacer)
+{
+	double	mean;
+	double	variance;
+
+	if (pacer->frames == 0)
+		return ;
+	mean = pacer->sum / pacer->frames;
+	variance = pacer->sum_sq / pacer->frames - mean * mean;
+	if (variance < 0)
+		variance = 0;
+	if (pacer->period > 0)
+		printf("[pacer] target %.3f ms (%ld fps), %ld missed\n",
+			pacer->period / 1000.0, 1000000 / pacer->period, pacer->missed);
+	else
+		printf("[pacer] uncapped\n");
+	printf("[pacer] %ld frames, mean %.3f ms (%.1f fps), jitter %.3f ms, "
+		"min %.3f ms, max %.3f ms\n", pacer->frames, mean / 1000.0,
+		1000000.0 / mean, sqrt(variance) / 1000.0, pacer->min / 1000.0,
+		pacer->max / 1000.0);
+}
@@ -0,0 +1,120 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   frame_shm.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:53:49 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 01:53:49 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+
+/* Slots are rounded to a cache line so every slot header starts on one */
+static void	ring_header(t_ring_page *ring, int slots)
+{
+	ft_memset(ring, 0, sizeof(t_ring_page));
+	ring->magic = FRAME_SHM_MAGIC;
+	ring->version = FRAME_SHM_VERSION;
+	ring->pid = getpid();
+	ring->slots = slots;
+	ring->width = WIDTH;
+	ring->height = HEIGHT;
+	ring->stride = WIDTH * 4;
+	ring->slot_size = (sizeof(t_ring_slot) + (size_t)ring->stride * HEIGHT
+			+ 63) & ~63UL;
+}
+
+/*
+** The ring starts empty with no consumer: until one attaches and releases
+** slots, every frame after the first slots ones is dropped.
+*/
+int	frame_ring_open(t_game *game, int slots)
+{
+	t_ring_page	ring;
+	t_ring_page	*page;
+	size_t		size;
+	int			fd;
+
+	ring_header(&ring, slots);
+	size = sizeof(t_ring_page) + slots * ring.slot_size;
+	fd = shm_open(FRAME_SHM_NAME, O_CREAT | O_RDWR, 0644);
+	if (fd < 0)
+		return (-1);
+	if (ftruncate(fd, size) < 0)
+		return (close(fd), -1);
+	page = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd);
+	if (page == MAP_FAILED)
+		return (-1);
+	*page = ring;
+	game->ring = page;
+	return (0);
+}
+
+static void	fill_slot(t_game *game, t_ring_slot *slot, int stride)
+{
+	char	*pixels;
+	int		y;
+
+	slot->frame = game->time.frame_count;
+	slot->time_us = get_time_us();
+	slot->x = game->camera.x;
+	slot->y = game->camera.y;
+	slot->dir_x = game->camera.dir_x;
+	slot->dir_y = game->camera.dir_y;
+	slot->plane_x = game->camera.plane_x;
+	slot->plane_y = game->camera.plane_y;
+	pixels = (char *)(slot + 1);
+	y = -1;
+	while (++y < HEIGHT)
+		ft_memcpy(pixels + (size_t)y * stride, game->img.addr
+			+ (size_t)y * game->img.line_length, stride);
+}
+
+/*
+** Producer side, once per presented frame. tail is read with acquire so
+** the consumer is done with a slot before it is overwritten, and head is
+** released only once the slot is complete. A full ring drops the frame:
+** the renderer never waits for the consumer.
+*/
+void	frame_ring_publish(t_game *game)
+{
+	t_ring_page		*ring;
+	unsigned long	head;
+
+	ring = game->ring;
+	if (!ring)
+		return ;
+	__atomic_store_n(&ring->offered, ring->offered + 1, __ATOMIC_RELAXED);
+	head = ring->head;
+	if (head - __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE)
+		>= (unsigned long)ring->slots)
+	{
+		__atomic_store_n(&ring->dropped, ring->dropped + 1, __ATOMIC_RELAXED);
+		return ;
+	}
+	TRACE_BEGIN("frame_ring_publish");
+	fill_slot(game, (t_ring_slot *)((char *)(ring + 1)
+			+ (head % ring->slots) * ring->slot_size), ring->stride);
+	__atomic_store_n(&ring->head, head + 1, __ATOMIC_RELEASE);
+	TRACE_END();
+}
+
+void	frame_ring_close(t_game *game)
+{
+	t_ring_page	*ring;
+
+	ring = game->ring;
+	if (!ring)
+		return ;
+	printf("[frames] %lu of %lu frames published to %s, %lu dropped\n",
+		ring->head, ring->offered, FRAME_SHM_NAME, ring->dropped);
+	munmap(ring, sizeof(t_ring_page) + ring->slots * ring->slot_size);
+	shm_unlink(FRAME_SHM_NAME);
+	game->ring = NULL;
+}
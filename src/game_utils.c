@@ -6,7 +6,7 @@
 /*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/23 00:00:00 by ataher            #+#    #+#             */
-/*   Updated: 2025/11/28 15:44:33 by ataher           ###   ########.fr       */
+/*   Updated: 2026/10/19 02:20:59 by ataher           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -19,31 +19,36 @@ void	ft_exit(int code, const char *message)
 	else if (message)
 		ft_printf("%s\n", message);
 	gc_clean();
+	arena_destroy(parse_arena());
 	exit(code);
 }
 
+static void	destroy_display(t_game *g)
+{
+	if (g->img.addr)
+		mem_account(MEM_RENDER, -(long)g->img.line_length * HEIGHT);
+	if (g->platform)
+		g->platform->close(g);
+	g->img.addr = NULL;
+}
+
 int	close_window(void *game)
 {
 	t_game	*g;
-	int		i;
 
 	g = (t_game *)game;
-	if (g->mlx)
-	{
-		if (g->img.img)
-			mlx_destroy_image(g->mlx, g->img.img);
-		i = 0;
-		while (i < 4)
-		{
-			if (g->textures[i].img.img)
-				mlx_destroy_image(g->mlx, g->textures[i].img.img);
-			i++;
-		}
-		if (g->win)
-			mlx_destroy_window(g->mlx, g->win);
-		mlx_destroy_display(g->mlx);
-		free(g->mlx);
-	}
+	mem_report();
+	pacer_report(&g->pacer);
+	input_report(&g->input);
+	replay_finish(g);
+	perf_report(&g->perf);
+	perf_close(&g->perf);
+	stats_close();
+	frame_ring_close(g);
+	capture_close(g);
+	destroy_textures(g);
+	TRACE_SHUTDOWN();
+	destroy_display(g);
 	ft_exit(0, NULL);
 	return (0);
 }
@@ -51,27 +56,41 @@ int	close_window(void *game)
 int	game_loop(void *game)
 {
 	t_game	*g;
+	long	start;
 
 	g = (t_game *)game;
+	pacer_wait_late(g);
+	start = get_time_us();
+	TRACE_FRAME(g->time.frame_count);
+	TRACE_BEGIN("frame");
 	update_delta_time(g);
-	process_movement(g);
+	input_drain(g);
+	sim_advance(g);
 	render_frame(g);
+	TRACE_BEGIN("texmgr_update");
+	texmgr_update(&g->texmgr);
+	TRACE_END();
+	TRACE_END();
+	if (g->time.frame_count++ == 0)
+		log_first_frame(g);
+	replay_frame(g, get_time_us() - start);
+	stats_publish(g);
+	TRACE_BEGIN("cap_framerate");
 	cap_framerate(g);
+	TRACE_END();
 	return (0);
 }
 
-void	init_mlx(t_game *game)
+/*
+** Opens the display through the selected backend, see platform.c. Only
+** the framebuffer is shared with the renderers.
+*/
+int	init_mlx(t_game *game)
 {
-	game->mlx = mlx_init();
-	if (!game->mlx)
-		ft_exit(1, "Failed to initialize MLX");
-	game->win = mlx_new_window(game->mlx, WIDTH, HEIGHT, "cub3D");
-	if (!game->win)
-		ft_exit(1, "Failed to create window");
-	game->img.img = mlx_new_image(game->mlx, WIDTH, HEIGHT);
-	if (!game->img.img)
-		ft_exit(1, "Failed to create image");
-	game->img.addr = mlx_get_data_addr(game->img.img,
-			&game->img.bits_per_pixel,
-			&game->img.line_length, &game->img.endian);
+	int	status;
+
+	status = game->platform->open(game);
+	if (status == 0)
+		mem_account(MEM_RENDER, (long)game->img.line_length * HEIGHT);
+	return (status);
 }
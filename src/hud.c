@@ -0,0 +1,117 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   hud.c                                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:40:28 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 00:40:28 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+/*
+** 5x7 bitmaps for HUD_CHARSET, row-major, most significant bit top-left.
+*/
+static unsigned long	hud_font(int index)
+{
+	static const unsigned long	font[HUD_CHARSET_LEN] = {
+		0x3A33AE62E, 0x11842108E, 0x3A211111F, 0x7C441062E,
+		0x08CA97C42, 0x7E1E0862E, 0x1910F462E, 0x7C2222108,
+		0x3A317462E, 0x3A317844C, 0x00000018C, 0x000000000,
+		0x3A31FC631, 0x7A318C63E, 0x7E10F421F, 0x7E10F4210,
+		0x4631FC631, 0x38842108E, 0x4775AC631, 0x4639ACE31,
+		0x7A31F4210, 0x7A31F5251, 0x3E107043E, 0x7C8421084,
+		0x46318C62E, 0x462A21084
+	};
+
+	return (font[index]);
+}
+
+void	hud_init(t_hud *hud, int visible)
+{
+	unsigned long	bits;
+	int				c;
+	int				x;
+	int				y;
+
+	ft_memset(hud, 0, sizeof(t_hud));
+	hud->visible = visible;
+	c = -1;
+	while (++c < HUD_CHARSET_LEN)
+	{
+		bits = hud_font(c);
+		y = -1;
+		while (++y < HUD_GLYPH_H * HUD_SCALE)
+		{
+			x = -1;
+			while (++x < HUD_GLYPH_W * HUD_SCALE)
+				hud->glyphs[c][y][x] = (bits >> (HUD_GLYPH_W * HUD_GLYPH_H
+							- 1 - (y / HUD_SCALE) * HUD_GLYPH_W
+							- x / HUD_SCALE)) & 1;
+		}
+	}
+}
+
+/*
+** Called once per frame after presentation. The graph keeps raw frame
+** times; the numbers are exponentially smoothed.
+*/
+void	hud_record(t_game *game)
+{
+	t_hud	*hud;
+	double	ms;
+	int		i;
+
+	hud = &game->hud;
+	ms = game->time.delta_time * 1000.0;
+	hud->history[hud->head] = ms;
+	hud->head = (hud->head + 1) % HUD_HISTORY;
+	hud->frame_ms += (ms - hud->frame_ms) * HUD_SMOOTHING;
+	i = -1;
+	while (++i < FRAME_STAGE_COUNT)
+	{
+		ms = (hud->stages[i].end - hud->stages[i].start) / 1000.0;
+		hud->stage_ms[i] += (ms - hud->stage_ms[i]) * HUD_SMOOTHING;
+	}
+}
+
+static void	hud_line(t_game *game, const char *label, double value, int y)
+{
+	char	buf[32];
+	int		x;
+
+	x = WIDTH - HUD_WIDTH;
+	hud_text(game, label, x, y);
+	hud_format(buf, value, 2);
+	hud_text(game, buf, x + 120, y);
+	hud_text(game, "MS", x + 200, y);
+}
+
+void	render_hud(t_game *game)
+{
+	static const char	*names[FRAME_STAGE_COUNT] = {
+		"3D", "MINIMAP", "RAYS", "PRESENT", "HUD"
+	};
+	char				buf[32];
+	int					y;
+	int					i;
+
+	if (!game->hud.visible)
+		return ;
+	stage_begin(&game->hud.stages[FRAME_HUD]);
+	hud_shade(&game->img, WIDTH - HUD_WIDTH - 10, 10, HUD_HEIGHT);
+	y = 20;
+	hud_text(game, "FPS", WIDTH - HUD_WIDTH, y);
+	hud_format(buf, 1000.0 / (game->hud.frame_ms + 0.001), 1);
+	hud_text(game, buf, WIDTH - HUD_WIDTH + 120, y);
+	hud_line(game, "FRAME", game->hud.frame_ms, y + HUD_LINE_H);
+	i = -1;
+	while (++i < FRAME_STAGE_COUNT)
+		hud_line(game, names[i], game->hud.stage_ms[i],
+			y + (i + 2) * HUD_LINE_H);
+	hud_graph(game, WIDTH - HUD_WIDTH, y + 7 * HUD_LINE_H + 6);
+	stage_end(&game->hud.stages[FRAME_HUD]);
+}
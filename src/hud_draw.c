@@ -0,0 +1,66 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   hud_draw.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:40:28 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 00:40:28 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+/*
+** Halves the brightness of the panel background, row by row straight in
+** the framebuffer.
+*/
+void	hud_shade(t_image *img, int x, int y, int height)
+{
+	unsigned int	*row;
+	int				i;
+	int				end;
+
+	end = y + height;
+	while (y < end && y < HEIGHT)
+	{
+		row = (unsigned int *)(img->addr + y * img->line_length) + x;
+		i = -1;
+		while (++i < HUD_WIDTH && x + i < WIDTH)
+			row[i] = (row[i] >> 1) & 8355711;
+		y++;
+	}
+}
+
+/*
+** One column per frame, oldest on the left. Bars over the pacer's period
+** are drawn in the slow color; the target line marks that period.
+*/
+void	hud_graph(t_game *game, int x, int y)
+{
+	double	ms;
+	int		bar;
+	int		color;
+	int		i;
+	int		j;
+
+	i = -1;
+	while (++i < HUD_HISTORY)
+	{
+		ms = game->hud.history[(game->hud.head + i) % HUD_HISTORY];
+		bar = (int)(ms / HUD_GRAPH_MS * HUD_GRAPH_H);
+		if (bar > HUD_GRAPH_H)
+			bar = HUD_GRAPH_H;
+		color = HUD_COLOR_GOOD;
+		if (game->pacer.period > 0 && ms * 1000.0 > game->pacer.period * 1.05)
+			color = HUD_COLOR_SLOW;
+		j = -1;
+		while (++j < bar)
+			my_mlx_pixel_put(&game->img, x + i, y + HUD_GRAPH_H - j, color);
+		if (game->pacer.period > 0)
+			my_mlx_pixel_put(&game->img, x + i, y + HUD_GRAPH_H
+				- (int)(game->pacer.period / 1000.0 / HUD_GRAPH_MS
+					* HUD_GRAPH_H), HUD_COLOR_TARGET);
+	}
+}
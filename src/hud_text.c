@@ -0,0 +1,85 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   hud_text.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:40:28 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 00:40:28 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+static void	hud_glyph(t_image *img, unsigned char (*glyph)[HUD_GLYPH_W
+	* HUD_SCALE], int x, int y)
+{
+	int	i;
+	int	j;
+
+	j = -1;
+	while (++j < HUD_GLYPH_H * HUD_SCALE)
+	{
+		i = -1;
+		while (++i < HUD_GLYPH_W * HUD_SCALE)
+			if (glyph[j][i])
+				my_mlx_pixel_put(img, x + i, y + j, HUD_COLOR_TEXT);
+	}
+}
+
+void	hud_text(t_game *game, const char *text, int x, int y)
+{
+	char	*found;
+
+	while (*text)
+	{
+		found = ft_strchr(HUD_CHARSET, *text);
+		if (found && *text != ' ')
+			hud_glyph(&game->img, game->hud.glyphs[found - HUD_CHARSET],
+				x, y);
+		x += (HUD_GLYPH_W + 1) * HUD_SCALE;
+		text++;
+	}
+}
+
+static char	*put_digits(char *buf, long n, int width)
+{
+	char	tmp[24];
+	int		len;
+
+	len = 0;
+	while (n > 0 || len < width)
+	{
+		tmp[len++] = '0' + n % 10;
+		n /= 10;
+	}
+	while (len > 0)
+		*buf++ = tmp[--len];
+	return (buf);
+}
+
+/*
+** Fixed-point formatting into buf without going through printf.
+*/
+void	hud_format(char *buf, double value, int decimals)
+{
+	long	scaled;
+	long	div;
+	int		i;
+
+	div = 1;
+	i = -1;
+	while (++i < decimals)
+		div *= 10;
+	if (value < 0 || value > 99999)
+		value = 99999;
+	scaled = (long)(value * div + 0.5);
+	buf = put_digits(buf, scaled / div, 1);
+	if (decimals > 0)
+	{
+		*buf++ = '.';
+		buf = put_digits(buf, scaled % div, decimals);
+	}
+	*buf = '\0';
+}
@@ -6,12 +6,22 @@
 /*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/23 00:00:00 by ataher            #+#    #+#             */
-/*   Updated: 2025/11/23 23:26:56 by ataher           ###   ########.fr       */
+/*   Updated: 2026/10/19 01:04:18 by ataher           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "cub3d.h"
 
+static void	handle_debug_key(int keycode, t_game *g)
+{
+	if (keycode == KEY_TAB)
+		g->hud.visible = !g->hud.visible;
+	if (keycode == KEY_T)
+		TRACE_DUMP();
+	if (keycode == KEY_M)
+		mem_report();
+}
+
 int	handle_keypress(int keycode, void *game)
 {
 	t_game	*g;
@@ -19,18 +29,9 @@ int	handle_keypress(int keycode, void *game)
 	g = (t_game *)game;
 	if (keycode == KEY_ESC)
 		close_window(g);
-	if (keycode == KEY_W)
-		g->keys.w = 1;
-	if (keycode == KEY_A)
-		g->keys.a = 1;
-	if (keycode == KEY_S)
-		g->keys.s = 1;
-	if (keycode == KEY_D)
-		g->keys.d = 1;
-	if (keycode == KEY_LEFT)
-		g->keys.left = 1;
-	if (keycode == KEY_RIGHT)
-		g->keys.right = 1;
+	handle_debug_key(keycode, g);
+	if (g->replay.mode != REPLAY_PLAY)
+		input_push(&g->input, keycode, 1);
 	return (0);
 }
 
@@ -39,17 +40,7 @@ int	handle_keyrelease(int keycode, void *game)
 	t_game	*g;
 
 	g = (t_game *)game;
-	if (keycode == KEY_W)
-		g->keys.w = 0;
-	if (keycode == KEY_A)
-		g->keys.a = 0;
-	if (keycode == KEY_S)
-		g->keys.s = 0;
-	if (keycode == KEY_D)
-		g->keys.d = 0;
-	if (keycode == KEY_LEFT)
-		g->keys.left = 0;
-	if (keycode == KEY_RIGHT)
-		g->keys.right = 0;
+	if (g->replay.mode != REPLAY_PLAY)
+		input_push(&g->input, keycode, 0);
 	return (0);
 }
@@ -0,0 +1,105 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   input_queue.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:04:18 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 01:04:18 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+/*
+** MLX hands the hooks a keycode only, not the XEvent, so events are
+** stamped on dispatch. A full queue drops the new event and counts it.
+*/
+int	input_push(t_input *input, int keycode, int pressed)
+{
+	unsigned int	tail;
+	t_input_event	*event;
+
+	tail = __atomic_load_n(&input->tail, __ATOMIC_RELAXED);
+	if (tail - __atomic_load_n(&input->head, __ATOMIC_ACQUIRE)
+		== INPUT_QUEUE_SIZE)
+	{
+		input->dropped++;
+		return (-1);
+	}
+	event = &input->events[tail % INPUT_QUEUE_SIZE];
+	event->time = get_time_us();
+	event->keycode = keycode;
+	event->pressed = pressed;
+	__atomic_store_n(&input->tail, tail + 1, __ATOMIC_RELEASE);
+	return (0);
+}
+
+static int	*key_field(t_keys *keys, int keycode)
+{
+	if (keycode == KEY_W)
+		return (&keys->w);
+	if (keycode == KEY_A)
+		return (&keys->a);
+	if (keycode == KEY_S)
+		return (&keys->s);
+	if (keycode == KEY_D)
+		return (&keys->d);
+	if (keycode == KEY_LEFT)
+		return (&keys->left);
+	if (keycode == KEY_RIGHT)
+		return (&keys->right);
+	return (NULL);
+}
+
+/*
+** Applies every queued transition to the key state just before the
+** update, so the simulation sees the latest input the frame can use.
+** Only events that change a key are timed, auto-repeat presses are not.
+*/
+void	input_drain(t_game *game)
+{
+	t_input			*input;
+	t_input_event	*event;
+	unsigned int	head;
+	int				*field;
+
+	input = &game->input;
+	head = input->head;
+	while (head != __atomic_load_n(&input->tail, __ATOMIC_ACQUIRE))
+	{
+		event = &input->events[head % INPUT_QUEUE_SIZE];
+		field = key_field(&game->keys, event->keycode);
+		if (field && *field != event->pressed
+			&& input->pending_count < INPUT_QUEUE_SIZE)
+			input->pending[input->pending_count++] = event->time;
+		if (field)
+			*field = event->pressed;
+		head++;
+	}
+	__atomic_store_n(&input->head, head, __ATOMIC_RELEASE);
+}
+
+/* Called right after the image is handed to the X server */
+void	input_presented(t_input *input, long now)
+{
+	long	latency;
+	long	bucket;
+	int		i;
+
+	i = 0;
+	while (i < input->pending_count)
+	{
+		latency = now - input->pending[i++];
+		input->count++;
+		input->sum += latency;
+		if (latency > input->max)
+			input->max = latency;
+		bucket = latency / LATENCY_BUCKET_US;
+		if (bucket >= LATENCY_BUCKETS)
+			bucket = LATENCY_BUCKETS - 1;
+		input->hist[bucket]++;
+	}
+	input->pending_count = 0;
+}
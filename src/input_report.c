@@ -0,0 +1,54 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   input_report.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:04:18 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 01:04:18 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+/*
+** Upper edge of the histogram bucket holding the q quantile, in us. The
+** last bucket collects everything beyond the range, its edge is the max.
+*/
+static long	latency_quantile(t_input *input, double q)
+{
+	long	target;
+	long	seen;
+	int		i;
+
+	target = (long)(q * input->count);
+	seen = 0;
+	i = 0;
+	while (i < LATENCY_BUCKETS - 1)
+	{
+		seen += input->hist[i];
+		if (seen > target)
+			break ;
+		i++;
+	}
+	if (i == LATENCY_BUCKETS - 1)
+		return (input->max);
+	return ((long)(i + 1) * LATENCY_BUCKET_US);
+}
+
+void	input_report(t_input *input)
+{
+	if (input->count == 0)
+	{
+		if (input->dropped)
+			printf("[latency] %ld event(s) dropped\n", input->dropped);
+		return ;
+	}
+	printf("[latency] %ld key event(s) to present: mean %.3f ms, "
+		"p50 %.1f ms, p99 %.1f ms, max %.3f ms, %ld dropped\n",
+		input->count, (double)input->sum / input->count / 1000.0,
+		latency_quantile(input, 0.5) / 1000.0,
+		latency_quantile(input, 0.99) / 1000.0, input->max / 1000.0,
+		input->dropped);
+}
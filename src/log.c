@@ -0,0 +1,55 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   log.c                                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 02:25:15 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 02:25:15 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+#include <stdarg.h>
+
+t_log_sink	*log_sink(void)
+{
+	static t_log_sink	instance;
+
+	return (&instance);
+}
+
+/*
+** Engine messages that can come from inside libcub3d.a, as opposed to
+** the frontend's reports. They go to stdout like the rest of the game's
+** output unless a host took them over with cub3d_set_log.
+*/
+void	log_line(const char *format, ...)
+{
+	char		line[LOG_LINE_MAX];
+	va_list		args;
+	t_log_sink	*sink;
+
+	sink = log_sink();
+	if (sink->quiet)
+		return ;
+	va_start(args, format);
+	vsnprintf(line, sizeof(line), format, args);
+	va_end(args);
+	if (sink->fn)
+		sink->fn(line, sink->user);
+	else
+		printf("%s\n", line);
+}
+
+/*
+** Hands the engine's log lines to fn, or silences them when fn is NULL.
+** Set it before cub3d_load: a loader thread may be logging meanwhile.
+*/
+void	cub3d_set_log(t_cub3d_log fn, void *user)
+{
+	log_sink()->fn = fn;
+	log_sink()->user = user;
+	log_sink()->quiet = (fn == NULL);
+}
@@ -6,43 +6,46 @@
 /*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/22 18:45:08 by ataher            #+#    #+#             */
-/*   Updated: 2025/12/27 00:13:31 by ataher           ###   ########.fr       */
+/*   Updated: 2026/10/19 02:20:59 by ataher           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "cub3d.h"
 
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wcast-function-type"
-
-static void	setup_hooks(t_game *game)
+/* Per-run subsystems that need the parsed config and the display */
+static void	init_runtime(t_game *game)
 {
-	mlx_hook(game->win, 2, 1L << 0, (int (*)(void))handle_keypress, game);
-	mlx_hook(game->win, 3, 1L << 1, (int (*)(void))handle_keyrelease, game);
-	mlx_hook(game->win, 17, 0, (int (*)(void))close_window, game);
-	mlx_loop_hook(game->mlx, game_loop, game);
+	game->time.last_frame = get_time_us();
+	game->time.delta_time = 0.016;
+	pacer_init(&game->pacer, game->options.target_fps);
+	replay_init(game);
+	hud_init(&game->hud, game->options.show_hud);
+	if (game->options.perf)
+		perf_init(&game->perf);
+	if (game->options.stats && stats_open() < 0)
+		printf("[stats] shared memory unavailable, --stats ignored\n");
+	if (game->options.frame_ring
+		&& frame_ring_open(game, game->options.frame_ring) < 0)
+		printf("[frames] shared memory unavailable, --frame-ring ignored\n");
+	if (game->options.capture_dir && capture_open(game) < 0)
+		ft_exit(1, "Failed to start frame capture");
+	sim_init(game, game->options.tick_rate);
 }
 
-#pragma GCC diagnostic pop
-
-
 int	main(int argc, char **argv)
 {
 	t_game	game;
 
-	if (argc != 2)
-		ft_exit(1, "Usage: ./cub3D <map.cub>");
+	ft_memset(&game, 0, sizeof(t_game));
+	game.time.start = get_time_us();
+	parse_options(&game.options, argc, argv);
+	game.platform = platform_select(&game.options);
+	TRACE_INIT(game.options.trace_path);
 	if (gc_init() != 0)
 		ft_exit(1, "Failed to initialize garbage collector");
-	ft_memset(&game, 0, sizeof(t_game));
-	parse_config_file(&(game.config), argv[1]);
-	init_mlx(&game);
-	load_textures(&game);
-	init_player(&game);
-	game.time.last_frame = get_time_us();
-	game.time.delta_time = 0.016;
-	setup_hooks(&game);
-	mlx_loop(game.mlx);
+	run_startup(&game, game.options.map_path);
+	init_runtime(&game);
+	game.platform->run(&game);
 	close_window(&game);
 	ft_exit(0, "Game exited successfully");
 	return (0);
@@ -0,0 +1,97 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   memory.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:49:38 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 02:26:18 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+t_mem_usage	*mem_usage(int tag)
+{
+	static t_mem_usage	usage[MEM_TAG_COUNT];
+
+	return (&usage[tag]);
+}
+
+/*
+** Positive sizes record an allocation, negative ones a release. The
+** texture loader thread accounts concurrently with the main thread, so
+** every field is updated atomically and the peak is raised by CAS.
+*/
+void	mem_account(int tag, long bytes)
+{
+	t_mem_usage	*u;
+	long		live;
+	long		peak;
+
+	if (bytes == 0)
+		return ;
+	u = mem_usage(tag);
+	live = __atomic_add_fetch(&u->bytes, bytes, __ATOMIC_RELAXED);
+	if (bytes < 0)
+	{
+		__atomic_sub_fetch(&u->count, 1, __ATOMIC_RELAXED);
+		return ;
+	}
+	__atomic_add_fetch(&u->count, 1, __ATOMIC_RELAXED);
+	__atomic_add_fetch(&u->allocs, 1, __ATOMIC_RELAXED);
+	peak = __atomic_load_n(&u->peak, __ATOMIC_RELAXED);
+	while (live > peak)
+	{
+		if (__atomic_compare_exchange_n(&u->peak, &peak, live, 1,
+				__ATOMIC_RELAXED, __ATOMIC_RELAXED))
+			break ;
+	}
+}
+
+/*
+** Parse-time allocations come from the parse arena, which is released in
+** one go at exit instead of block by block.
+*/
+void	*mem_alloc(int tag, size_t size)
+{
+	void	*ptr;
+
+	ptr = arena_alloc(parse_arena(), size);
+	if (ptr)
+		arena_account(parse_arena(), tag, size);
+	return (ptr);
+}
+
+char	*mem_strdup(int tag, const char *s)
+{
+	char	*dup;
+
+	dup = arena_strdup(parse_arena(), s);
+	if (dup)
+		arena_account(parse_arena(), tag, ft_strlen(dup) + 1);
+	return (dup);
+}
+
+void	mem_report(void)
+{
+	static const char	*names[MEM_TAG_COUNT] = {"parser", "map",
+		"textures", "render"};
+	t_mem_usage			*u;
+	int					i;
+
+	printf("[memory] %-10s %12s %8s %12s %8s\n", "tag", "live KiB", "blocks",
+		"peak KiB", "allocs");
+	i = 0;
+	while (i < MEM_TAG_COUNT)
+	{
+		u = mem_usage(i);
+		printf("[memory] %-10s %12.1f %8ld %12.1f %8ld\n", names[i],
+			__atomic_load_n(&u->bytes, __ATOMIC_RELAXED) / 1024.0,
+			__atomic_load_n(&u->count, __ATOMIC_RELAXED),
+			__atomic_load_n(&u->peak, __ATOMIC_RELAXED) / 1024.0,
+			__atomic_load_n(&u->allocs, __ATOMIC_RELAXED));
+		i++;
+	}
+}
@@ -0,0 +1,45 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   memory_lines.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:49:38 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 02:26:18 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+/*
+** get_next_line hands out malloc'd lines sized to their content, so the
+** release side recomputes the same length instead of storing it.
+*/
+char	*mem_next_line(int fd)
+{
+	char	*line;
+
+	line = get_next_line(fd);
+	if (line)
+		mem_account(MEM_PARSER, ft_strlen(line) + 1);
+	return (line);
+}
+
+void	mem_free_line(char *line)
+{
+	if (!line)
+		return ;
+	mem_account(MEM_PARSER, -(long)(ft_strlen(line) + 1));
+	free(line);
+}
+
+/* Releases blocks allocations of bytes in total, for a whole arena */
+void	mem_release(int tag, long bytes, long blocks)
+{
+	t_mem_usage	*u;
+
+	u = mem_usage(tag);
+	__atomic_sub_fetch(&u->bytes, bytes, __ATOMIC_RELAXED);
+	__atomic_sub_fetch(&u->count, blocks, __ATOMIC_RELAXED);
+}
@@ -0,0 +1,146 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   options.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:33:33 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 02:00:01 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+static int	apply_flag_option(t_options *options, char *name)
+{
+	int	*flag;
+
+	flag = NULL;
+	if (ft_strcmp(name, "--hud") == 0)
+		flag = &options->show_hud;
+	else if (ft_strcmp(name, "--perf") == 0)
+		flag = &options->perf;
+	else if (ft_strcmp(name, "--stats") == 0)
+		flag = &options->stats;
+	else if (ft_strcmp(name, "--low-latency") == 0)
+		flag = &options->low_latency;
+	else if (ft_strcmp(name, "--headless") == 0)
+		flag = &options->headless;
+	if (!flag)
+		return (-1);
+	*flag = 1;
+	return (1);
+}
+
+static int	apply_named_option(t_options *options, char *name, char *value)
+{
+	char	**target;
+
+	if (apply_flag_option(options, name) > 0)
+		return (1);
+	target = NULL;
+	if (ft_strcmp(name, "--record") == 0)
+		target = &options->record_path;
+	else if (ft_strcmp(name, "--replay") == 0)
+		target = &options->replay_path;
+	else if (ft_strcmp(name, "--timings") == 0)
+		target = &options->timings_path;
+	else if (ft_strcmp(name, "--trace") == 0)
+		target = &options->trace_path;
+	else if (ft_strcmp(name, "--path") == 0)
+		target = &options->path_name;
+	else if (ft_strcmp(name, "--report") == 0)
+		target = &options->report_path;
+	else if (ft_strcmp(name, "--capture") == 0)
+		target = &options->capture_dir;
+	if (!target || !value)
+		return (-1);
+	*target = value;
+	return (2);
+}
+
+/* Integer options; --fps accepts 0 for uncapped, the others need 1+ */
+static int	apply_count_option(t_options *options, char *name, char *value)
+{
+	int	*target;
+	int	min;
+
+	target = NULL;
+	min = 1;
+	if (ft_strcmp(name, "--tick-rate") == 0)
+		target = &options->tick_rate;
+	else if (ft_strcmp(name, "--frames") == 0)
+		target = &options->frames;
+	else if (ft_strcmp(name, "--frame-ring") == 0)
+		target = &options->frame_ring;
+	else if (ft_strcmp(name, "--capture-buffers") == 0)
+		target = &options->capture_buffers;
+	else if (ft_strcmp(name, "--fps") == 0)
+	{
+		target = &options->target_fps;
+		min = 0;
+	}
+	if (!target)
+		return (0);
+	*target = parse_count(value);
+	if (*target < min)
+		return (-1);
+	return (2);
+}
+
+/*
+** Returns how many arguments the option consumed, or -1 if it is unknown
+** or its value is invalid.
+*/
+static int	apply_option(t_options *options, char *name, char *value)
+{
+	int	used;
+
+	if (ft_strcmp(name, "--texture-budget") == 0)
+	{
+		options->texture_budget = parse_size(value);
+		if (options->texture_budget == 0)
+			return (-1);
+		return (2);
+	}
+	if (ft_strcmp(name, "--capture-format") == 0)
+	{
+		options->capture_format = parse_capture_format(value);
+		if (options->capture_format < 0)
+			return (-1);
+		return (2);
+	}
+	used = apply_count_option(options, name, value);
+	if (used != 0)
+		return (used);
+	return (apply_named_option(options, name, value));
+}
+
+void	parse_options(t_options *options, int argc, char **argv)
+{
+	int	i;
+	int	used;
+
+	options->texture_budget = TEXMGR_DEFAULT_BUDGET;
+	options->target_fps = TARGET_FPS;
+	options->tick_rate = SIM_TICK_RATE;
+	options->capture_format = CAPTURE_PPM;
+	options->capture_buffers = CAPTURE_BUFFERS;
+	i = 1;
+	while (i < argc)
+	{
+		used = 1;
+		if (argv[i][0] == '-' && argv[i][1])
+			used = apply_option(options, argv[i], argv[i + 1]);
+		else if (options->map_path)
+			used = -1;
+		else
+			options->map_path = argv[i];
+		if (used < 0)
+			ft_exit(1, OPTIONS_USAGE);
+		i += used;
+	}
+	if (!options->map_path)
+		ft_exit(1, OPTIONS_USAGE);
+}
@@ -0,0 +1,65 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   options_utils.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:45:48 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 02:00:01 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+/*
+** Parses a byte count with an optional binary K/M/G suffix. Returns 0 on
+** malformed input, which no option accepts as a valid value.
+*/
+size_t	parse_size(const char *s)
+{
+	size_t	value;
+
+	value = 0;
+	if (!s || !ft_isdigit(*s))
+		return (0);
+	while (ft_isdigit(*s))
+		value = value * 10 + (*s++ - '0');
+	if (*s == 'K' || *s == 'k')
+		value <<= 10;
+	else if (*s == 'M' || *s == 'm')
+		value <<= 20;
+	else if (*s == 'G' || *s == 'g')
+		value <<= 30;
+	else if (*s)
+		return (0);
+	if (*s && s[1])
+		return (0);
+	return (value);
+}
+
+int	parse_count(const char *s)
+{
+	long	value;
+
+	value = 0;
+	if (!s || !*s)
+		return (-1);
+	while (ft_isdigit(*s) && value <= INT_MAX)
+		value = value * 10 + (*s++ - '0');
+	if (*s || value > INT_MAX)
+		return (-1);
+	return ((int)value);
+}
+
+/* raw, ppm or rle, see capture.c; -1 for anything else */
+int	parse_capture_format(const char *s)
+{
+	if (s && ft_strcmp((char *)s, "raw") == 0)
+		return (CAPTURE_RAW);
+	if (s && ft_strcmp((char *)s, "ppm") == 0)
+		return (CAPTURE_PPM);
+	if (s && ft_strcmp((char *)s, "rle") == 0)
+		return (CAPTURE_RLE);
+	return (-1);
+}
@@ -6,7 +6,7 @@
 /*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/23 13:27:25 by ataher            #+#    #+#             */
-/*   Updated: 2025/11/23 14:38:55 by ataher           ###   ########.fr       */
+/*   Updated: 2026/10/19 00:49:38 by ataher           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -18,13 +18,13 @@ static int	count_map_lines(int fd)
 	int		count;
 
 	count = 0;
-	line = get_next_line(fd);
+	line = mem_next_line(fd);
 	while (line)
 	{
 		if (is_map_line(line))
 			count++;
-		free(line);
-		line = get_next_line(fd);
+		mem_free_line(line);
+		line = mem_next_line(fd);
 	}
 	return (count);
 }
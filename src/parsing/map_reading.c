@@ -6,7 +6,7 @@
 /*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/23 13:27:25 by ataher            #+#    #+#             */
-/*   Updated: 2025/11/23 23:26:56 by ataher           ###   ########.fr       */
+/*   Updated: 2026/10/19 00:49:38 by ataher           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -26,13 +26,13 @@ static int	check_remaining_lines(int fd)
 {
 	char	*line;
 
-	line = get_next_line(fd);
+	line = mem_next_line(fd);
 	while (line)
 	{
 		if (is_non_empty_line(line))
-			return (free(line), -1);
-		free(line);
-		line = get_next_line(fd);
+			return (mem_free_line(line), -1);
+		mem_free_line(line);
+		line = mem_next_line(fd);
 	}
 	return (0);
 }
@@ -45,22 +45,22 @@ static int	process_map_lines(t_config *config, int fd)
 
 	idx = 0;
 	map_started = 0;
-	line = get_next_line(fd);
+	line = mem_next_line(fd);
 	while (line && idx < config->map.height)
 	{
 		if (is_map_line(line))
 		{
 			map_started = 1;
 			if (store_map_line(config, line, idx++) < 0)
-				return (free(line), -1);
+				return (mem_free_line(line), -1);
 		}
 		else if (map_started && is_non_empty_line(line))
-			return (free(line), -1);
-		free(line);
-		line = get_next_line(fd);
+			return (mem_free_line(line), -1);
+		mem_free_line(line);
+		line = mem_next_line(fd);
 	}
 	if (line)
-		free(line);
+		mem_free_line(line);
 	return (check_remaining_lines(fd));
 }
 
@@ -68,7 +68,8 @@ int	read_map_content(t_config *config, const char *path)
 {
 	int		fd;
 
-	config->map.grid = gc_malloc((config->map.height + 1) * sizeof(char *));
+	config->map.grid = mem_alloc(MEM_MAP,
+			(config->map.height + 1) * sizeof(char *));
 	if (!config->map.grid)
 		return (-1);
 	ft_memset(config->map.grid, 0, (config->map.height + 1) * sizeof(char *));
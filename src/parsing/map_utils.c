@@ -6,7 +6,7 @@
 /*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/23 13:27:25 by ataher            #+#    #+#             */
-/*   Updated: 2025/11/23 15:22:39 by ataher           ###   ########.fr       */
+/*   Updated: 2026/10/19 00:49:38 by ataher           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -55,7 +55,7 @@ int	store_map_line(t_config *config, char *line, int idx)
 	len = get_line_length(line);
 	if (len > config->map.width)
 		config->map.width = len;
-	config->map.grid[idx] = gc_strdup(line);
+	config->map.grid[idx] = mem_strdup(MEM_MAP, line);
 	if (!config->map.grid[idx])
 		return (-1);
 	if (config->map.grid[idx][len] == '\n')
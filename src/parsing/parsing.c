@@ -6,7 +6,7 @@
 /*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/23 13:27:25 by ataher            #+#    #+#             */
-/*   Updated: 2025/11/28 15:27:47 by ataher           ###   ########.fr       */
+/*   Updated: 2026/10/19 01:44:46 by ataher           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -17,24 +17,30 @@ static int	read_config_lines(t_config *config, int fd)
 	char	*line;
 	int		result;
 
-	line = get_next_line(fd);
+	line = mem_next_line(fd);
 	while (line != NULL)
 	{
 		if (is_map_line(line))
 		{
-			free(line);
+			mem_free_line(line);
 			break ;
 		}
 		result = parse_config_line(config, line);
-		free(line);
+		mem_free_line(line);
 		if (result < 0)
 			return (-2);
-		line = get_next_line(fd);
+		line = mem_next_line(fd);
 	}
 	return (0);
 }
 
-int	parse_config_file(t_config *config, char *path)
+/*
+** Reads the identifier lines only. Texture paths are known once this
+** returns, which lets texture decoding start before the map is parsed.
+** Like parse_config_map, returns 0 or minus the exit code of the error,
+** see parse_error.
+*/
+int	parse_config_header(t_config *config, char *path)
 {
 	int		fd;
 	int		result;
@@ -43,21 +49,47 @@ int	parse_config_file(t_config *config, char *path)
 	ft_memset(config, 0, sizeof(t_config));
 	len = ft_strlen(path);
 	if (len < 4 || ft_strcmp(path + len - 4, ".cub") != 0)
-		ft_exit(2, "Map file must have .cub extension");
+		return (-2);
 	fd = open(path, O_RDONLY);
 	if (fd < 0)
-		ft_exit(3, "Failed to open map file");
+		return (-3);
 	result = read_config_lines(config, fd);
 	close(fd);
 	if (result == -2)
-		ft_exit(4, "Invalid or duplicate identifier/s");
+		return (-4);
 	if ((config->config_flags & FLAG_ALL) != FLAG_ALL)
-		ft_exit(5, "Missing identifier element/s");
+		return (-5);
+	return (0);
+}
+
+int	parse_config_map(t_config *config, char *path)
+{
 	if (parse_map(config, path) < 0)
-		ft_exit(6, "Invalid map format");
-	print_config(config);
-	print_map(config->map.grid, config->map.height);
+		return (-6);
 	if (validate_map_walls(config) < 0)
-		ft_exit(1, "Map not properly closed by walls");
+		return (-1);
 	return (0);
 }
+
+int	parse_config_file(t_config *config, char *path)
+{
+	int	status;
+
+	status = parse_config_header(config, path);
+	if (status < 0)
+		return (status);
+	return (parse_config_map(config, path));
+}
+
+const char	*parse_error(int status)
+{
+	static const char	*messages[7] = {NULL,
+		"Map not properly closed by walls",
+		"Map file must have .cub extension", "Failed to open map file",
+		"Invalid or duplicate identifier/s", "Missing identifier element/s",
+		"Invalid map format"};
+
+	if (status >= 0 || status < -6)
+		return (NULL);
+	return (messages[-status]);
+}
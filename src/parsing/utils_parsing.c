@@ -6,7 +6,7 @@
 /*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/23 13:27:25 by ataher            #+#    #+#             */
-/*   Updated: 2025/11/28 15:26:44 by ataher           ###   ########.fr       */
+/*   Updated: 2026/10/19 00:49:38 by ataher           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -47,7 +47,7 @@ int	set_texture(t_config *config, char **texture, char *path, int flag)
 	if (fd < 0)
 		return (-1);
 	close(fd);
-	*texture = gc_strdup(path);
+	*texture = mem_strdup(MEM_TEXTURES, path);
 	if (!*texture)
 		return (-1);
 	config->config_flags |= flag;
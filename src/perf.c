@@ -0,0 +1,103 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   perf.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:44:04 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 00:44:04 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+#include <errno.h>
+#include <string.h>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+
+static unsigned long	perf_config(int counter, unsigned int *type)
+{
+	static const unsigned long	configs[PERF_COUNTERS] = {
+		PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+		PERF_COUNT_HW_CACHE_LL | PERF_COUNT_HW_CACHE_OP_READ << 8
+		| PERF_COUNT_HW_CACHE_RESULT_MISS << 16,
+		PERF_COUNT_HW_CACHE_DTLB | PERF_COUNT_HW_CACHE_OP_READ << 8
+		| PERF_COUNT_HW_CACHE_RESULT_MISS << 16,
+		PERF_COUNT_HW_BRANCH_MISSES
+	};
+
+	*type = PERF_TYPE_HARDWARE;
+	if (counter == 2 || counter == 3)
+		*type = PERF_TYPE_HW_CACHE;
+	return (configs[counter]);
+}
+
+static int	perf_open(int counter, int group)
+{
+	struct perf_event_attr	attr;
+
+	ft_memset(&attr, 0, sizeof(attr));
+	attr.size = sizeof(attr);
+	attr.config = perf_config(counter, &attr.type);
+	attr.disabled = (group == -1);
+	attr.exclude_kernel = 1;
+	attr.exclude_hv = 1;
+	attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED
+		| PERF_FORMAT_TOTAL_TIME_RUNNING;
+	return (syscall(SYS_perf_event_open, &attr, 0, -1, group, 0));
+}
+
+/*
+** Counters the kernel refuses (no PMU in a container or VM, a paranoid
+** setting, an event the CPU lacks) are skipped one by one; if none open,
+** profiling is switched off and the game runs as usual.
+*/
+void	perf_init(t_perf *perf)
+{
+	int	i;
+
+	ft_memset(perf, 0, sizeof(t_perf));
+	perf->leader = -1;
+	i = -1;
+	while (++i < PERF_COUNTERS)
+	{
+		perf->fds[i] = perf_open(i, perf->leader);
+		perf->slot[i] = -1;
+		if (perf->fds[i] < 0)
+			continue ;
+		if (perf->leader < 0)
+			perf->leader = perf->fds[i];
+		perf->slot[i] = perf->nr++;
+	}
+	if (perf->leader < 0)
+	{
+		printf("[perf] hardware counters unavailable (%s), --perf ignored\n",
+			strerror(errno));
+		return ;
+	}
+	ioctl(perf->leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+	ioctl(perf->leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+	perf->enabled = 1;
+}
+
+/*
+** Reads the group as time_enabled, time_running, then one value per open
+** counter, into out[0 .. nr + 1].
+*/
+int	perf_read(t_perf *perf, unsigned long *out)
+{
+	unsigned long	buf[PERF_COUNTERS + 3];
+	ssize_t			len;
+	int				i;
+
+	len = read(perf->leader, buf, sizeof(buf));
+	if (len < (ssize_t)(3 * sizeof(unsigned long))
+		|| buf[0] != (unsigned long)perf->nr)
+		return (-1);
+	i = -1;
+	while (++i < perf->nr + 2)
+		out[i] = buf[i + 1];
+	return (0);
+}
@@ -0,0 +1,105 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   perf_stage.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:44:04 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 00:44:04 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+void	perf_stage_begin(t_perf *perf)
+{
+	if (perf->enabled && perf_read(perf, perf->start) < 0)
+		perf->enabled = 0;
+}
+
+/*
+** Adds the counter deltas since perf_stage_begin to stage. Intervals in
+** which the group was not on the PMU the whole time are still counted
+** but flagged as multiplexed in the report.
+*/
+void	perf_stage_end(t_perf *perf, int stage)
+{
+	unsigned long	now[PERF_COUNTERS + 2];
+	int				i;
+
+	if (!perf->enabled)
+		return ;
+	if (perf_read(perf, now) < 0)
+	{
+		perf->enabled = 0;
+		return ;
+	}
+	if (now[0] - perf->start[0] != now[1] - perf->start[1])
+		perf->multiplexed++;
+	i = -1;
+	while (++i < PERF_COUNTERS)
+		if (perf->slot[i] >= 0)
+			perf->totals[stage][i] += now[perf->slot[i] + 2]
+				- perf->start[perf->slot[i] + 2];
+	perf->samples[stage]++;
+}
+
+static void	perf_report_stage(t_perf *perf, int stage, const char *name)
+{
+	unsigned long	*totals;
+	long			n;
+	int				i;
+
+	totals = perf->totals[stage];
+	n = perf->samples[stage];
+	printf("[perf] %-24s", name);
+	i = -1;
+	while (++i < PERF_COUNTERS)
+	{
+		if (perf->slot[i] < 0)
+			printf(" %12s", "n/a");
+		else
+			printf(" %12lu", totals[i] / n);
+	}
+	if (perf->slot[0] >= 0 && perf->slot[1] >= 0 && totals[0] > 0)
+		printf(" %6.2f", (double)totals[1] / totals[0]);
+	printf("\n");
+}
+
+void	perf_report(t_perf *perf)
+{
+	static const char	*names[FRAME_STAGE_COUNT] = {
+		"render_3d", "render_minimap", "draw_minimap_rays",
+		"mlx_put_image_to_window", "hud"
+	};
+	int					stage;
+
+	if (perf->nr == 0 || perf->samples[FRAME_RENDER_3D] == 0)
+		return ;
+	printf("[perf] per-frame averages over %ld frames\n",
+		perf->samples[FRAME_RENDER_3D]);
+	printf("[perf] %-24s %12s %12s %12s %12s %12s %6s\n", "stage", "cycles",
+		"instructions", "llc-misses", "dtlb-misses", "br-misses", "ipc");
+	stage = -1;
+	while (++stage < FRAME_STAGE_COUNT)
+		if (perf->samples[stage] > 0)
+			perf_report_stage(perf, stage, names[stage]);
+	if (perf->multiplexed > 0)
+		printf("[perf] %ld sample(s) multiplexed, counts are partial\n",
+			perf->multiplexed);
+}
+
+void	perf_close(t_perf *perf)
+{
+	int	i;
+
+	if (perf->nr == 0)
+		return ;
+	i = -1;
+	while (++i < PERF_COUNTERS)
+		if (perf->fds[i] >= 0)
+			close(perf->fds[i]);
+	perf->enabled = 0;
+	perf->nr = 0;
+}
@@ -0,0 +1,21 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   platform.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:07:25 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 01:44:46 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+/* Builds made with HEADLESS=1 have no MLX backend to fall back on */
+t_platform	*platform_select(t_options *options)
+{
+	if (options->headless)
+		return (platform_headless());
+	return (PLATFORM_DEFAULT());
+}
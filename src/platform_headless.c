@@ -0,0 +1,74 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   platform_headless.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:07:25 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 02:18:02 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+/*
+** The frame lives in plain memory laid out like an MLX image, so every
+** renderer writes exactly the same bytes as it does on a display.
+*/
+static int	headless_open(t_game *game)
+{
+	game->img.bits_per_pixel = 32;
+	game->img.line_length = WIDTH * 4;
+	game->img.endian = 0;
+	game->img.addr = aligned_alloc(TEXTURE_ALIGN,
+			(size_t)game->img.line_length * HEIGHT);
+	if (!game->img.addr)
+		return (-3);
+	ft_memset(game->img.addr, 0, (size_t)game->img.line_length * HEIGHT);
+	return (0);
+}
+
+static void	headless_present(t_game *game)
+{
+	(void)game;
+}
+
+/*
+** Runs --frames frames back to back through the normal game_loop, so
+** pacing, the simulation, replays and every report behave as on screen.
+** Without --frames a playback runs to its end, where it closes the game.
+*/
+static void	headless_run(t_game *game)
+{
+	long	frames;
+	long	start;
+	long	elapsed;
+
+	frames = game->options.frames;
+	if (frames <= 0 && game->replay.mode == REPLAY_PLAY)
+		frames = game->replay.header.ticks + 1;
+	if (frames <= 0)
+		frames = HEADLESS_FRAMES;
+	start = get_time_us();
+	while (frames-- > 0)
+		game_loop(game);
+	elapsed = get_time_us() - start;
+	printf("[headless] %ld frames in %.3f ms (%.3f ms/frame), "
+		"last frame %016lx\n", game->time.frame_count, elapsed / 1000.0,
+		elapsed / 1000.0 / game->time.frame_count, frame_hash(&game->img));
+}
+
+static void	headless_close(t_game *game)
+{
+	free(game->img.addr);
+	game->img.addr = NULL;
+}
+
+t_platform	*platform_headless(void)
+{
+	static t_platform	ops = {"headless", headless_open,
+		headless_present, headless_run, headless_close};
+
+	return (&ops);
+}
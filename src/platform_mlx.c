@@ -0,0 +1,70 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   platform_mlx.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:07:25 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 01:07:25 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+static int	window_open(t_game *game)
+{
+	game->mlx = mlx_init();
+	if (!game->mlx)
+		return (-1);
+	game->win = mlx_new_window(game->mlx, WIDTH, HEIGHT, "cub3D");
+	if (!game->win)
+		return (-2);
+	game->img.img = mlx_new_image(game->mlx, WIDTH, HEIGHT);
+	if (!game->img.img)
+		return (-3);
+	game->img.addr = mlx_get_data_addr(game->img.img,
+			&game->img.bits_per_pixel,
+			&game->img.line_length, &game->img.endian);
+	return (0);
+}
+
+static void	window_present(t_game *game)
+{
+	mlx_put_image_to_window(game->mlx, game->win, game->img.img, 0, 0);
+}
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wcast-function-type"
+
+static void	window_run(t_game *game)
+{
+	mlx_hook(game->win, 2, 1L << 0, (int (*)(void))handle_keypress, game);
+	mlx_hook(game->win, 3, 1L << 1, (int (*)(void))handle_keyrelease, game);
+	mlx_hook(game->win, 17, 0, (int (*)(void))close_window, game);
+	mlx_loop_hook(game->mlx, game_loop, game);
+	mlx_loop(game->mlx);
+}
+
+#pragma GCC diagnostic pop
+
+static void	window_close(t_game *game)
+{
+	if (!game->mlx)
+		return ;
+	if (game->img.img)
+		mlx_destroy_image(game->mlx, game->img.img);
+	if (game->win)
+		mlx_destroy_window(game->mlx, game->win);
+	mlx_destroy_display(game->mlx);
+	free(game->mlx);
+	game->mlx = NULL;
+}
+
+t_platform	*platform_mlx(void)
+{
+	static t_platform	ops = {"mlx", window_open, window_present,
+		window_run, window_close};
+
+	return (&ops);
+}
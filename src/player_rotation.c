@@ -6,7 +6,7 @@
 /*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/23 00:00:00 by ataher            #+#    #+#             */
-/*   Updated: 2025/11/23 23:26:56 by ataher           ###   ########.fr       */
+/*   Updated: 2026/10/19 00:35:58 by ataher           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -47,13 +47,13 @@ void	rotate_right(t_game *game, double rot_speed)
 		+ game->player.plane_y * cos(rot_speed);
 }
 
-void	process_movement(t_game *game)
+void	process_movement(t_game *game, double dt)
 {
 	double	move_speed;
 	double	rot_speed;
 
-	move_speed = MOVE_SPEED * game->time.delta_time;
-	rot_speed = ROT_SPEED * game->time.delta_time;
+	move_speed = MOVE_SPEED * dt;
+	rot_speed = ROT_SPEED * dt;
 	if (game->keys.w)
 		move_forward(game, move_speed);
 	if (game->keys.s)
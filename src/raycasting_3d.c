@@ -6,55 +6,59 @@
 /*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/23 00:00:00 by ataher            #+#    #+#             */
-/*   Updated: 2025/11/23 22:43:07 by ataher           ###   ########.fr       */
+/*   Updated: 2026/10/19 01:39:20 by ataher           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "cub3d.h"
 #include <math.h>
 
-void	init_ray(t_game *game, t_ray *ray, int x)
+void	init_ray(t_view *view, t_ray *ray, int x)
 {
-	ray->camera_x = 2 * x / (double)WIDTH - 1;
-	ray->ray_dir_x = game->player.dir_x + game->player.plane_x * ray->camera_x;
-	ray->ray_dir_y = game->player.dir_y + game->player.plane_y * ray->camera_x;
-	ray->map_x = (int)game->player.x;
-	ray->map_y = (int)game->player.y;
+	ray->camera_x = 2 * x / (double)view->width - 1;
+	ray->ray_dir_x = view->camera.dir_x + view->camera.plane_x * ray->camera_x;
+	ray->ray_dir_y = view->camera.dir_y + view->camera.plane_y * ray->camera_x;
+	ray->map_x = (int)view->camera.x;
+	ray->map_y = (int)view->camera.y;
 	ray->delta_dist_x = fabs(1 / ray->ray_dir_x);
 	ray->delta_dist_y = fabs(1 / ray->ray_dir_y);
 	ray->hit = 0;
 }
 
-void	calculate_step_and_side_dist(t_game *game, t_ray *ray)
+void	calculate_step_and_side_dist(t_view *view, t_ray *ray)
 {
 	if (ray->ray_dir_x < 0)
 	{
 		ray->step_x = -1;
-		ray->side_dist_x = (game->player.x - ray->map_x) * ray->delta_dist_x;
+		ray->side_dist_x = (view->camera.x - ray->map_x) * ray->delta_dist_x;
 	}
 	else
 	{
 		ray->step_x = 1;
-		ray->side_dist_x = (ray->map_x + 1.0 - game->player.x)
+		ray->side_dist_x = (ray->map_x + 1.0 - view->camera.x)
 			* ray->delta_dist_x;
 	}
 	if (ray->ray_dir_y < 0)
 	{
 		ray->step_y = -1;
-		ray->side_dist_y = (game->player.y - ray->map_y) * ray->delta_dist_y;
+		ray->side_dist_y = (view->camera.y - ray->map_y) * ray->delta_dist_y;
 	}
 	else
 	{
 		ray->step_y = 1;
-		ray->side_dist_y = (ray->map_y + 1.0 - game->player.y)
+		ray->side_dist_y = (ray->map_y + 1.0 - view->camera.y)
 			* ray->delta_dist_y;
 	}
 }
 
 void	perform_dda(t_game *game, t_ray *ray)
 {
+	unsigned long	steps;
+
+	steps = 0;
 	while (ray->hit == 0)
 	{
+		steps++;
 		if (ray->side_dist_x < ray->side_dist_y)
 		{
 			ray->side_dist_x += ray->delta_dist_x;
@@ -73,21 +77,24 @@ void	perform_dda(t_game *game, t_ray *ray)
 		else if (game->config.map.grid[ray->map_y][ray->map_x] == WALL)
 			ray->hit = 1;
 	}
+	stats_add(STAT_DDA_STEPS, steps);
 }
 
-void	calculate_wall_distance(t_game *game, t_ray *ray)
+void	calculate_wall_distance(t_view *view, t_ray *ray)
 {
 	if (ray->side == 0)
-		ray->perp_wall_dist = (ray->map_x - game->player.x
+		ray->perp_wall_dist = (ray->map_x - view->camera.x
 				+ (1 - ray->step_x) / 2) / ray->ray_dir_x;
 	else
-		ray->perp_wall_dist = (ray->map_y - game->player.y
+		ray->perp_wall_dist = (ray->map_y - view->camera.y
 				+ (1 - ray->step_y) / 2) / ray->ray_dir_y;
-	ray->line_height = (int)(HEIGHT / ray->perp_wall_dist);
-	ray->draw_start = -ray->line_height / 2 + HEIGHT / 2;
+	if (ray->perp_wall_dist < MIN_WALL_DIST)
+		ray->perp_wall_dist = MIN_WALL_DIST;
+	ray->line_height = (int)(view->height / ray->perp_wall_dist);
+	ray->draw_start = -ray->line_height / 2 + view->height / 2;
 	if (ray->draw_start < 0)
 		ray->draw_start = 0;
-	ray->draw_end = ray->line_height / 2 + HEIGHT / 2;
-	if (ray->draw_end >= HEIGHT)
-		ray->draw_end = HEIGHT - 1;
+	ray->draw_end = ray->line_height / 2 + view->height / 2;
+	if (ray->draw_end >= view->height)
+		ray->draw_end = view->height - 1;
 }
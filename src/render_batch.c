@@ -0,0 +1,113 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   render_batch.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:37:55 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 02:23:29 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+#include <unistd.h>
+
+/* A view of the whole window from the game camera */
+void	view_init(t_view *view, t_game *game, t_image *img)
+{
+	ft_memset(view, 0, sizeof(t_view));
+	view->game = game;
+	view->camera = game->camera;
+	view->img = img;
+	view->width = WIDTH;
+	view->height = HEIGHT;
+}
+
+/* Claims frames one at a time until the batch runs out */
+static void	*batch_worker(void *arg)
+{
+	t_batch_job	*job;
+	t_view		view;
+	int			i;
+
+	job = (t_batch_job *)arg;
+	view = job->view;
+	i = __atomic_fetch_add(&job->next, 1, __ATOMIC_RELAXED);
+	while (i < job->batch->count)
+	{
+		view.camera = job->batch->poses[i];
+		view.img = &job->batch->frames[i];
+		if (job->batch->aux)
+			view.aux = &job->batch->aux[i];
+		render_view(&view);
+		i = __atomic_fetch_add(&job->next, 1, __ATOMIC_RELAXED);
+	}
+	return (NULL);
+}
+
+static int	batch_threads(int count)
+{
+	long	cpus;
+
+	cpus = sysconf(_SC_NPROCESSORS_ONLN);
+	if (cpus > RENDER_MAX_THREADS)
+		cpus = RENDER_MAX_THREADS;
+	if (cpus > count)
+		cpus = count;
+	if (cpus < 1)
+		cpus = 1;
+	return ((int)cpus);
+}
+
+/*
+** The four faces are loaded before any worker starts, so a batch never
+** renders placeholders and gives the same frames however far streaming
+** has got. Only texmgr_update evicts, which cannot run during the call.
+*/
+static int	batch_walls(t_game *game, t_view *view)
+{
+	int	face;
+
+	face = -1;
+	while (++face < 4)
+	{
+		texmgr_request(&game->texmgr, game->wall_tex[face]);
+		if (texmgr_wait(&game->texmgr, game->wall_tex[face]) < 0)
+			return (-1);
+		view->walls[face] = texmgr_get(&game->texmgr, game->wall_tex[face]);
+	}
+	return (0);
+}
+
+/*
+** Renders every pose of the batch, spread over the cores with the
+** caller's thread taking a share. The map and the wall textures are
+** shared read-only. Returns -1 if the frame size is empty or larger than
+** the window, or if a wall texture cannot be loaded.
+*/
+int	render_batch(t_game *game, t_batch *batch)
+{
+	pthread_t	threads[RENDER_MAX_THREADS];
+	t_batch_job	job;
+	int			started;
+
+	if (batch->count <= 0 || batch->width <= 0 || batch->height <= 0
+		|| batch->width > WIDTH || batch->height > HEIGHT)
+		return (-1);
+	job.batch = batch;
+	job.next = 0;
+	view_init(&job.view, game, NULL);
+	job.view.width = batch->width;
+	job.view.height = batch->height;
+	if (batch_walls(game, &job.view) < 0)
+		return (-1);
+	started = 0;
+	while (started < batch_threads(batch->count) - 1
+		&& pthread_create(&threads[started], NULL, batch_worker, &job) == 0)
+		started++;
+	batch_worker(&job);
+	while (started > 0)
+		pthread_join(threads[--started], NULL);
+	return (0);
+}
@@ -6,7 +6,7 @@
 /*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/23 00:00:00 by ataher            #+#    #+#             */
-/*   Updated: 2025/11/28 15:23:38 by ataher           ###   ########.fr       */
+/*   Updated: 2026/10/19 01:44:46 by ataher           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -96,11 +96,26 @@ void	draw_minimap_player(t_game *game)
 	}
 }
 
-void	render_frame(t_game *game)
+/*
+** FNV-1a over the visible pixels, skipping row padding, so identical
+** frames hash the same on every backend.
+*/
+unsigned long	frame_hash(t_image *img)
 {
-	render_3d(game);
-	render_minimap(game);
-	draw_minimap_rays(game);
-	draw_minimap_player(game);
-	mlx_put_image_to_window(game->mlx, game->win, game->img.img, 0, 0);
+	unsigned long	hash;
+	unsigned char	*row;
+	int				x;
+	int				y;
+
+	hash = 0xCBF29CE484222325UL;
+	y = 0;
+	while (y < HEIGHT)
+	{
+		row = (unsigned char *)img->addr + (size_t)y * img->line_length;
+		x = 0;
+		while (x < WIDTH * 4)
+			hash = (hash ^ row[x++]) * 0x100000001B3UL;
+		y++;
+	}
+	return (hash);
 }
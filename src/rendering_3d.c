@@ -6,92 +6,95 @@
 /*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/23 00:00:00 by ataher            #+#    #+#             */
-/*   Updated: 2025/11/28 15:51:02 by ataher           ###   ########.fr       */
+/*   Updated: 2026/10/19 01:50:17 by ataher           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "cub3d.h"
 
-static t_texture	*get_wall_texture(t_game *game, t_ray *ray)
+/*
+** The window view resolves a face on first use, so a face nobody looks at
+** stays evictable. Batch views arrive with all four already resolved.
+*/
+static t_texture	*get_wall_texture(t_view *view, t_ray *ray)
 {
-	if (ray->side == 0)
-	{
-		if (ray->ray_dir_x > 0)
-			return (&game->textures[EAST]);
-		else
-			return (&game->textures[WEST]);
-	}
-	else
-	{
-		if (ray->ray_dir_y > 0)
-			return (&game->textures[SOUTH]);
-		else
-			return (&game->textures[NORTH]);
-	}
+	int	face;
+
+	face = wall_face(ray);
+	if (!view->walls[face])
+		view->walls[face] = texmgr_get(&view->game->texmgr,
+				view->game->wall_tex[face]);
+	return (view->walls[face]);
 }
 
-static void	draw_textured_wall(t_game *game, t_ray *ray, int x)
+void	draw_textured_wall(t_view *view, t_ray *ray, int x)
 {
-	t_texture	*texture;
-	int			tex_x;
-	double		vars[2];
-	int			color;
-	int			y;
+	t_stripe	stripe;
 
-	texture = get_wall_texture(game, ray);
-	tex_x = calculate_tex_x(ray, calculate_wall_x(game, ray), texture->width);
-	vars[0] = 1.0 * texture->height / ray->line_height;
-	vars[1] = (ray->draw_start - HEIGHT / 2 + ray->line_height / 2) * vars[0];
-	y = ray->draw_start;
-	while (y < ray->draw_end)
-	{
-		color = get_texture_color(texture, tex_x, (int)vars[1]
-				& (texture->height - 1));
-		if (ray->side == 1)
-			color = (color >> 1) & 8355711;
-		my_mlx_pixel_put(&game->img, x, y, color);
-		vars[1] += vars[0];
-		y++;
-	}
+	stripe.texture = get_wall_texture(view, ray);
+	stripe.x = x;
+	stripe.tex_x = calculate_tex_x(ray, calculate_wall_x(view, ray),
+			stripe.texture->width);
+	stripe.step = 1.0 * stripe.texture->height / ray->line_height;
+	stripe.pos = (ray->draw_start - view->height / 2 + ray->line_height / 2)
+		* stripe.step;
+	stats_add(STAT_TEXELS, ray->draw_end - ray->draw_start);
+	if (stripe.texture->indices)
+		draw_stripe_palettized(view, ray, &stripe);
+	else
+		draw_stripe_truecolor(view, ray, &stripe);
 }
 
-void	draw_wall_stripe(t_game *game, t_ray *ray, int x)
+void	draw_wall_stripe(t_view *view, t_ray *ray, int x)
 {
-	int	y;
-	int	colors[2];
+	t_config	*config;
+	int			y;
+	int			colors[2];
 
-	colors[0] = (game->config.ceiling.r << 16)
-		| (game->config.ceiling.g << 8) | game->config.ceiling.b;
-	colors[1] = (game->config.floor.r << 16)
-		| (game->config.floor.g << 8) | game->config.floor.b;
+	config = &view->game->config;
+	colors[0] = (config->ceiling.r << 16)
+		| (config->ceiling.g << 8) | config->ceiling.b;
+	colors[1] = (config->floor.r << 16)
+		| (config->floor.g << 8) | config->floor.b;
 	y = 0;
 	while (y < ray->draw_start)
 	{
-		my_mlx_pixel_put(&game->img, x, y, colors[0]);
+		my_mlx_pixel_put(view->img, x, y, colors[0]);
 		y++;
 	}
-	draw_textured_wall(game, ray, x);
+	draw_textured_wall(view, ray, x);
 	y = ray->draw_end;
-	while (y < HEIGHT)
+	while (y < view->height)
 	{
-		my_mlx_pixel_put(&game->img, x, y, colors[1]);
+		my_mlx_pixel_put(view->img, x, y, colors[1]);
 		y++;
 	}
+	stats_add(STAT_PIXELS, view->height);
 }
 
-void	render_3d(t_game *game)
+void	render_view(t_view *view)
 {
 	t_ray	ray;
 	int		x;
 
 	x = 0;
-	while (x < WIDTH)
+	while (x < view->width)
 	{
-		init_ray(game, &ray, x);
-		calculate_step_and_side_dist(game, &ray);
-		perform_dda(game, &ray);
-		calculate_wall_distance(game, &ray);
-		draw_wall_stripe(game, &ray, x);
+		init_ray(view, &ray, x);
+		calculate_step_and_side_dist(view, &ray);
+		perform_dda(view->game, &ray);
+		calculate_wall_distance(view, &ray);
+		if (view->aux)
+			store_aux(view->aux, &ray, x);
+		draw_wall_stripe(view, &ray, x);
 		x++;
 	}
 }
+
+void	render_3d(t_game *game)
+{
+	t_view	view;
+
+	view_init(&view, game, &game->img);
+	render_view(&view);
+}
@@ -0,0 +1,64 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   rendering_3d_stripe.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:28:47 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 01:39:20 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+void	draw_stripe_truecolor(t_view *view, t_ray *ray, t_stripe *stripe)
+{
+	int	color;
+	int	y;
+
+	y = ray->draw_start;
+	while (y < ray->draw_end)
+	{
+		color = get_texture_color(stripe->texture, stripe->tex_x,
+				(int)stripe->pos & (stripe->texture->height - 1));
+		if (ray->side == 1)
+			color = (color >> 1) & 8355711;
+		my_mlx_pixel_put(view->img, stripe->x, y, color);
+		stripe->pos += stripe->step;
+		y++;
+	}
+}
+
+/*
+** Palettized walls read one byte per texel. The column base and the
+** palette (already shaded for y-sides) are resolved once per stripe.
+*/
+void	draw_stripe_palettized(t_view *view, t_ray *ray, t_stripe *stripe)
+{
+	unsigned int	*palette;
+	unsigned char	*column;
+	int				width;
+	int				mask;
+	int				y;
+
+	if (stripe->tex_x < 0 || stripe->tex_x >= stripe->texture->width)
+	{
+		draw_stripe_truecolor(view, ray, stripe);
+		return ;
+	}
+	palette = stripe->texture->palette;
+	if (ray->side == 1)
+		palette = stripe->texture->shaded;
+	column = stripe->texture->indices + stripe->tex_x;
+	width = stripe->texture->width;
+	mask = stripe->texture->height - 1;
+	y = ray->draw_start;
+	while (y < ray->draw_end)
+	{
+		my_mlx_pixel_put(view->img, stripe->x, y,
+			palette[column[((int)stripe->pos & mask) * width]]);
+		stripe->pos += stripe->step;
+		y++;
+	}
+}
@@ -6,7 +6,7 @@
 /*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/23 00:00:00 by ataher            #+#    #+#             */
-/*   Updated: 2025/11/28 15:50:28 by ataher           ###   ########.fr       */
+/*   Updated: 2026/10/19 01:50:17 by ataher           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -25,14 +25,38 @@ int	calculate_tex_x(t_ray *ray, double wall_x, int tex_width)
 	return (tex_x);
 }
 
-double	calculate_wall_x(t_game *game, t_ray *ray)
+double	calculate_wall_x(t_view *view, t_ray *ray)
 {
 	double	wall_x;
 
 	if (ray->side == 0)
-		wall_x = game->player.y + ray->perp_wall_dist * ray->ray_dir_y;
+		wall_x = view->camera.y + ray->perp_wall_dist * ray->ray_dir_y;
 	else
-		wall_x = game->player.x + ray->perp_wall_dist * ray->ray_dir_x;
+		wall_x = view->camera.x + ray->perp_wall_dist * ray->ray_dir_x;
 	wall_x -= floor(wall_x);
 	return (wall_x);
 }
+
+int	wall_face(t_ray *ray)
+{
+	if (ray->side == 0 && ray->ray_dir_x > 0)
+		return (EAST);
+	if (ray->side == 0)
+		return (WEST);
+	if (ray->ray_dir_y > 0)
+		return (SOUTH);
+	return (NORTH);
+}
+
+void	store_aux(t_aux *aux, t_ray *ray, int x)
+{
+	if (aux->depth)
+		aux->depth[x] = (float)ray->perp_wall_dist;
+	if (aux->face)
+		aux->face[x] = (unsigned char)wall_face(ray);
+	if (aux->tile)
+	{
+		aux->tile[2 * x] = ray->map_x;
+		aux->tile[2 * x + 1] = ray->map_y;
+	}
+}
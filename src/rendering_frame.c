@@ -0,0 +1,51 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   rendering_frame.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:42:45 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 02:00:01 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+static void	present_frame(t_game *game)
+{
+	game->platform->present(game);
+	input_presented(&game->input, get_time_us());
+}
+
+static void	run_stage(t_game *game, int stage, const char *name,
+	void (*fn)(t_game *))
+{
+	(void)name;
+	stage_begin(&game->hud.stages[stage]);
+	TRACE_BEGIN(name);
+	perf_stage_begin(&game->perf);
+	fn(game);
+	perf_stage_end(&game->perf, stage);
+	TRACE_END();
+	stage_end(&game->hud.stages[stage]);
+}
+
+/*
+** Each stage is timed for the HUD, traced, and sampled with --perf. The
+** overlay is drawn before the image is presented, so it shows the
+** previous frame's presentation time.
+*/
+void	render_frame(t_game *game)
+{
+	run_stage(game, FRAME_RENDER_3D, "render_3d", render_3d);
+	run_stage(game, FRAME_MINIMAP, "render_minimap", render_minimap);
+	run_stage(game, FRAME_RAYS, "draw_minimap_rays", draw_minimap_rays);
+	draw_minimap_player(game);
+	render_hud(game);
+	run_stage(game, FRAME_PRESENT, "mlx_put_image_to_window",
+		present_frame);
+	hud_record(game);
+	frame_ring_publish(game);
+	capture_frame(game);
+}
@@ -6,7 +6,7 @@
 /*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/23 00:00:00 by ataher            #+#    #+#             */
-/*   Updated: 2025/11/28 15:30:35 by ataher           ###   ########.fr       */
+/*   Updated: 2026/10/19 00:35:58 by ataher           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -32,8 +32,8 @@ int	get_tile_color(t_game *game, int map_x, int map_y)
 
 void	get_camera_start(t_game *game, int *cam_start_x, int *cam_start_y)
 {
-	*cam_start_x = (int)game->player.x - MINIMAP_VIEWPORT_TILES / 2;
-	*cam_start_y = (int)game->player.y - MINIMAP_VIEWPORT_TILES / 2;
+	*cam_start_x = (int)game->camera.x - MINIMAP_VIEWPORT_TILES / 2;
+	*cam_start_y = (int)game->camera.y - MINIMAP_VIEWPORT_TILES / 2;
 }
 
 void	get_player_center(t_game *game, int *center_x, int *center_y)
@@ -41,8 +41,8 @@ void	get_player_center(t_game *game, int *center_x, int *center_y)
 	double	player_offset_x;
 	double	player_offset_y;
 
-	player_offset_x = game->player.x - (int)game->player.x;
-	player_offset_y = game->player.y - (int)game->player.y;
+	player_offset_x = game->camera.x - (int)game->camera.x;
+	player_offset_y = game->camera.y - (int)game->camera.y;
 	*center_x = MINIMAP_OFFSET_X + (MINIMAP_VIEWPORT_TILES / 2) * MINIMAP_SCALE
 		+ (int)(player_offset_x * MINIMAP_SCALE);
 	*center_y = MINIMAP_OFFSET_Y + (MINIMAP_VIEWPORT_TILES / 2) * MINIMAP_SCALE
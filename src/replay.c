@@ -0,0 +1,142 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   replay.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:38:10 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 01:26:22 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+#include <fcntl.h>
+
+static int	read_all(int fd, void *buf, size_t len)
+{
+	ssize_t	got;
+
+	while (len > 0)
+	{
+		got = read(fd, buf, len);
+		if (got <= 0)
+			return (-1);
+		buf = (char *)buf + got;
+		len -= got;
+	}
+	return (0);
+}
+
+static int	replay_load(t_replay *replay, const char *path)
+{
+	int	fd;
+	int	status;
+
+	fd = open(path, O_RDONLY);
+	if (fd < 0)
+		return (-1);
+	status = read_all(fd, &replay->header, sizeof(t_replay_header));
+	if (status == 0 && (replay->header.magic != REPLAY_MAGIC
+			|| replay->header.version != REPLAY_VERSION
+			|| replay->header.tick_rate <= 0 || replay->header.ticks <= 0
+			|| replay->header.events < 0))
+		status = -1;
+	if (status == 0)
+		replay->events = malloc(sizeof(t_key_event)
+				* (replay->header.events + 1));
+	if (status == 0 && !replay->events)
+		status = -1;
+	if (status == 0)
+		status = read_all(fd, replay->events,
+				sizeof(t_key_event) * replay->header.events);
+	close(fd);
+	return (status);
+}
+
+static void	replay_start(t_game *game, t_replay *replay)
+{
+	char	*source;
+	int		status;
+
+	source = game->options.path_name;
+	if (source)
+		status = replay_script(game, replay, source);
+	else
+	{
+		source = game->options.replay_path;
+		status = replay_load(replay, source);
+	}
+	if (status < 0)
+		ft_exit(1, "Invalid replay file or path name");
+	replay->frame_us = malloc(sizeof(long) * replay->header.ticks);
+	replay->stage_us = malloc(sizeof(long) * replay->header.ticks
+			* FRAME_STAGE_COUNT);
+	if (!replay->frame_us || !replay->stage_us)
+		ft_exit(1, "Failed to allocate replay timings");
+	game->player = replay->header.player;
+	game->options.tick_rate = replay->header.tick_rate;
+	replay->keys = replay->header.keys;
+	mask_to_keys(replay->keys, &game->keys);
+	replay->mode = REPLAY_PLAY;
+	printf("[replay] %s: %ld ticks at %d Hz, %ld key events\n", source,
+		replay->header.ticks, replay->header.tick_rate, replay->header.events);
+}
+
+/*
+** Runs after init_player and before sim_init: playback replaces the
+** spawn state and tick rate with the recorded ones. --path plays a
+** built-in fly-through instead of a file, see replay_script.
+*/
+void	replay_init(t_game *game)
+{
+	t_replay	*replay;
+
+	replay = &game->replay;
+	ft_memset(replay, 0, sizeof(t_replay));
+	if ((game->options.replay_path || game->options.path_name)
+		&& game->options.record_path)
+		ft_exit(1, "Cannot record and replay at the same time");
+	if (game->options.replay_path || game->options.path_name)
+	{
+		replay_start(game, replay);
+		return ;
+	}
+	if (!game->options.record_path)
+		return ;
+	replay->header.magic = REPLAY_MAGIC;
+	replay->header.version = REPLAY_VERSION;
+	replay->header.tick_rate = game->options.tick_rate;
+	replay->header.player = game->player;
+	replay->keys = keys_to_mask(&game->keys);
+	replay->header.keys = replay->keys;
+	replay->mode = REPLAY_RECORD;
+}
+
+/*
+** Called before every simulation tick. Recording stores the key mask
+** whenever it differs from the previous tick; playback applies the
+** events stamped with the current tick to t_keys.
+*/
+void	replay_tick(t_game *game)
+{
+	t_replay		*replay;
+	unsigned int	mask;
+
+	replay = &game->replay;
+	if (replay->mode == REPLAY_RECORD)
+	{
+		mask = keys_to_mask(&game->keys);
+		if (mask != replay->keys
+			&& replay_push(replay, game->sim.ticks, mask) < 0)
+			ft_exit(1, "Failed to record input");
+		replay->keys = mask;
+		replay->header.ticks = game->sim.ticks + 1;
+	}
+	while (replay->mode == REPLAY_PLAY
+		&& replay->next < replay->header.events
+		&& replay->events[replay->next].tick <= game->sim.ticks)
+		replay->keys = replay->events[replay->next++].keys;
+	if (replay->mode == REPLAY_PLAY)
+		mask_to_keys(replay->keys, &game->keys);
+}
@@ -0,0 +1,98 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   replay_json.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:26:22 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 03:00:57 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+#include <stdio.h>
+
+static void	write_stage(FILE *out, const char *name, t_timing_summary *sum,
+		const char *sep)
+{
+	fprintf(out, "    \"%s\": {\"mean_ms\": %.3f, \"p50_ms\": %.3f, "
+		"\"p99_ms\": %.3f, \"max_ms\": %.3f}%s\n", name, sum->mean / 1000.0,
+		sum->p50 / 1000.0, sum->p99 / 1000.0, sum->max / 1000.0, sep);
+}
+
+/*
+** "frame" is the whole work time of a frame, the other stages are the
+** render stages timed for the HUD. hud stays at zero unless --hud.
+*/
+static void	write_stages(FILE *out, t_replay *replay)
+{
+	static const char	*names[FRAME_STAGE_COUNT] = {
+		"render_3d", "render_minimap", "draw_minimap_rays",
+		"mlx_put_image_to_window", "hud"
+	};
+	t_timing_summary	sum;
+	int					stage;
+
+	if (summarize_timings(replay->frame_us, replay->frames, 1, &sum) < 0)
+		ft_memset(&sum, 0, sizeof(sum));
+	write_stage(out, "frame", &sum, ",");
+	stage = -1;
+	while (++stage < FRAME_STAGE_COUNT)
+	{
+		if (summarize_timings(replay->stage_us + stage, replay->frames,
+				FRAME_STAGE_COUNT, &sum) < 0)
+			ft_memset(&sum, 0, sizeof(sum));
+		if (stage == FRAME_STAGE_COUNT - 1)
+			write_stage(out, names[stage], &sum, "");
+		else
+			write_stage(out, names[stage], &sum, ",");
+	}
+}
+
+/* Writes s as a JSON string, with quotes, backslashes and controls escaped */
+static void	write_string(FILE *out, const char *s)
+{
+	if (!s)
+	{
+		fputs("null", out);
+		return ;
+	}
+	fputc('"', out);
+	while (*s)
+	{
+		if (*s == '"' || *s == '\\')
+			fprintf(out, "\\%c", *s);
+		else if ((unsigned char)*s < 0x20)
+			fprintf(out, "\\u%04x", (unsigned char)*s);
+		else
+			fputc(*s, out);
+		s++;
+	}
+	fputc('"', out);
+}
+
+/* One JSON object per playback, written by --report for tools/bench.sh */
+int	replay_write_json(t_game *game, const char *path, unsigned long hash)
+{
+	FILE		*out;
+	const char	*source;
+
+	out = fopen(path, "w");
+	if (!out)
+		return (-1);
+	source = game->options.path_name;
+	if (!source)
+		source = game->options.replay_path;
+	fprintf(out, "{\n  \"map\": ");
+	write_string(out, game->options.map_path);
+	fprintf(out, ",\n  \"path\": ");
+	write_string(out, source);
+	fprintf(out, ",\n  \"tick_rate\": %d,\n  \"frames\": %ld,\n"
+		"  \"frame_hash\": \"%016lx\",\n  \"run_hash\": \"%016lx\",\n"
+		"  \"stages\": {\n", game->replay.header.tick_rate,
+		game->replay.frames, hash, game->replay.run_hash);
+	write_stages(out, &game->replay);
+	fprintf(out, "  }\n}\n");
+	return (fclose(out));
+}
@@ -0,0 +1,95 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   replay_report.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:38:10 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 02:51:40 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+#include <stdio.h>
+
+/*
+** Playback runs exactly one simulation tick per frame; once every
+** recorded tick has been simulated the game shuts down and reports.
+** Every presented frame is folded into run_hash, FNV-1a style, so a
+** change to any frame of the run shows up in the report.
+*/
+void	replay_frame(t_game *game, long work_us)
+{
+	t_replay	*replay;
+	long		*stage_us;
+	int			i;
+
+	replay = &game->replay;
+	if (replay->mode != REPLAY_PLAY)
+		return ;
+	if (replay->frames < replay->header.ticks)
+	{
+		stage_us = replay->stage_us + replay->frames * FRAME_STAGE_COUNT;
+		i = -1;
+		while (++i < FRAME_STAGE_COUNT)
+			stage_us[i] = game->hud.stages[i].end - game->hud.stages[i].start;
+		if (replay->frames == 0)
+			replay->run_hash = 0xCBF29CE484222325UL;
+		replay->run_hash = (replay->run_hash ^ frame_hash(&game->img))
+			* 0x100000001B3UL;
+		replay->frame_us[replay->frames++] = work_us;
+	}
+	if (game->sim.ticks >= replay->header.ticks)
+		close_window(game);
+}
+
+static int	write_timings(t_replay *replay, const char *path)
+{
+	FILE	*out;
+	long	i;
+
+	out = fopen(path, "w");
+	if (!out)
+		return (-1);
+	fprintf(out, "frame,work_us\n");
+	i = -1;
+	while (++i < replay->frames)
+		fprintf(out, "%ld,%ld\n", i, replay->frame_us[i]);
+	return (fclose(out));
+}
+
+/*
+** Per-frame work time covers simulation, rendering and presentation but
+** not the pacer's sleep, so runs at different --fps stay comparable. The
+** run hash covers every frame, so runs can be checked for identical
+** output; the last frame's hash is kept next to it.
+*/
+void	replay_report(t_game *game)
+{
+	t_replay			*replay;
+	t_options			*options;
+	t_timing_summary	sum;
+	unsigned long		hash;
+
+	replay = &game->replay;
+	options = &game->options;
+	if (replay->frames == 0)
+		return ;
+	if (options->timings_path
+		&& write_timings(replay, options->timings_path) < 0)
+		ft_dprintf(2, RED "Error: Failed to write %s\n" RESET,
+			options->timings_path);
+	hash = frame_hash(&game->img);
+	if (options->report_path
+		&& replay_write_json(game, options->report_path, hash) < 0)
+		ft_dprintf(2, RED "Error: Failed to write %s\n" RESET,
+			options->report_path);
+	if (summarize_timings(replay->frame_us, replay->frames, 1, &sum) < 0)
+		return ;
+	printf("[replay] %ld frames in %.3f ms, mean %.3f ms, p50 %.3f ms, "
+		"p95 %.3f ms, p99 %.3f ms, max %.3f ms, last frame %016lx, "
+		"run %016lx\n", sum.count, sum.mean * sum.count / 1000.0,
+		sum.mean / 1000.0, sum.p50 / 1000.0, sum.p95 / 1000.0,
+		sum.p99 / 1000.0, sum.max / 1000.0, hash, replay->run_hash);
+}
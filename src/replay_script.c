@@ -0,0 +1,70 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   replay_script.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:26:22 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 01:26:22 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+/*
+** Fly-throughs for the bench, started from the map's spawn. sweep turns
+** a full circle in place, corridor walks and turns along the view, hug
+** strafes into walls so the camera keeps grazing them.
+*/
+static const t_path_step	*path_steps(char *name)
+{
+	static const t_path_step	sweep[] = {{REPLAY_KEY_RIGHT, 3142},
+	{0, 0}};
+	static const t_path_step	corridor[] = {{REPLAY_KEY_W, 2000},
+	{REPLAY_KEY_W | REPLAY_KEY_LEFT, 400}, {REPLAY_KEY_W, 1500},
+	{REPLAY_KEY_RIGHT, 785}, {REPLAY_KEY_W, 1500}, {0, 0}};
+	static const t_path_step	hug[] = {{REPLAY_KEY_W | REPLAY_KEY_D, 1500},
+	{REPLAY_KEY_W | REPLAY_KEY_A, 1500}, {REPLAY_KEY_RIGHT, 1571},
+	{REPLAY_KEY_W | REPLAY_KEY_D, 1500}, {REPLAY_KEY_W | REPLAY_KEY_A, 1000},
+	{0, 0}};
+
+	if (ft_strcmp(name, "sweep") == 0)
+		return (sweep);
+	if (ft_strcmp(name, "corridor") == 0)
+		return (corridor);
+	if (ft_strcmp(name, "hug") == 0)
+		return (hug);
+	return (NULL);
+}
+
+/*
+** Builds a playback replay from a named path, as if it had been recorded
+** at the current --tick-rate. Returns -1 for an unknown name.
+*/
+int	replay_script(t_game *game, t_replay *replay, char *name)
+{
+	const t_path_step	*steps;
+	unsigned int		tick;
+
+	steps = path_steps(name);
+	if (!steps)
+		return (-1);
+	tick = 0;
+	while (steps->ms > 0)
+	{
+		if (replay_push(replay, tick, steps->keys) < 0)
+			return (-1);
+		tick += (long)steps->ms * game->options.tick_rate / 1000;
+		steps++;
+	}
+	if (replay_push(replay, tick, 0) < 0)
+		return (-1);
+	replay->header.magic = REPLAY_MAGIC;
+	replay->header.version = REPLAY_VERSION;
+	replay->header.tick_rate = game->options.tick_rate;
+	replay->header.player = game->player;
+	replay->header.keys = 0;
+	replay->header.ticks = tick + 1;
+	return (0);
+}
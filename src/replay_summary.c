@@ -0,0 +1,58 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   replay_summary.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:26:22 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 01:27:14 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+static int	compare_long(const void *a, const void *b)
+{
+	long	x;
+	long	y;
+
+	x = *(const long *)a;
+	y = *(const long *)b;
+	return ((x > y) - (x < y));
+}
+
+/*
+** Summarizes n samples taken every stride longs from values, which is
+** left untouched: the samples are sorted in a scratch copy.
+*/
+int	summarize_timings(long *values, long n, long stride,
+		t_timing_summary *out)
+{
+	long	*sorted;
+	long	total;
+	long	i;
+
+	if (n <= 0)
+		return (-1);
+	sorted = malloc(sizeof(long) * n);
+	if (!sorted)
+		return (-1);
+	total = 0;
+	i = -1;
+	while (++i < n)
+	{
+		sorted[i] = values[i * stride];
+		total += sorted[i];
+	}
+	qsort(sorted, n, sizeof(long), compare_long);
+	out->count = n;
+	out->mean = (double)total / n;
+	out->min = sorted[0];
+	out->p50 = sorted[n / 2];
+	out->p95 = sorted[n * 95 / 100];
+	out->p99 = sorted[n * 99 / 100];
+	out->max = sorted[n - 1];
+	free(sorted);
+	return (0);
+}
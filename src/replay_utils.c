@@ -0,0 +1,95 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   replay_utils.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:38:10 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 01:26:22 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+#include <fcntl.h>
+
+unsigned int	keys_to_mask(t_keys *keys)
+{
+	return ((keys->w != 0) | (keys->a != 0) << 1 | (keys->s != 0) << 2
+		| (keys->d != 0) << 3 | (keys->left != 0) << 4
+		| (keys->right != 0) << 5);
+}
+
+void	mask_to_keys(unsigned int mask, t_keys *keys)
+{
+	keys->w = mask & 1;
+	keys->a = (mask >> 1) & 1;
+	keys->s = (mask >> 2) & 1;
+	keys->d = (mask >> 3) & 1;
+	keys->left = (mask >> 4) & 1;
+	keys->right = (mask >> 5) & 1;
+}
+
+int	replay_push(t_replay *replay, unsigned int tick, unsigned int keys)
+{
+	t_key_event	*grown;
+
+	if (replay->header.events == replay->capacity)
+	{
+		replay->capacity = replay->capacity * 2 + 64;
+		grown = malloc(sizeof(t_key_event) * replay->capacity);
+		if (!grown)
+			return (-1);
+		if (replay->events)
+			ft_memcpy(grown, replay->events,
+				sizeof(t_key_event) * replay->header.events);
+		free(replay->events);
+		replay->events = grown;
+	}
+	replay->events[replay->header.events++] = (t_key_event){tick, keys};
+	return (0);
+}
+
+static int	replay_save(t_replay *replay, const char *path)
+{
+	int	fd;
+	int	status;
+
+	fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if (fd < 0)
+		return (-1);
+	status = texcache_write_all(fd, &replay->header, sizeof(t_replay_header));
+	if (status == 0)
+		status = texcache_write_all(fd, replay->events,
+				sizeof(t_key_event) * replay->header.events);
+	if (close(fd) < 0)
+		status = -1;
+	return (status);
+}
+
+/*
+** Called once on shutdown: a recording is written out, a playback prints
+** its timing report. Either way the replay is released.
+*/
+void	replay_finish(t_game *game)
+{
+	t_replay	*replay;
+
+	replay = &game->replay;
+	if (replay->mode == REPLAY_RECORD)
+	{
+		if (replay_save(replay, game->options.record_path) < 0)
+			ft_dprintf(2, RED "Error: Failed to write %s\n" RESET,
+				game->options.record_path);
+		else
+			printf("[replay] recorded %ld ticks, %ld key events to %s\n",
+				replay->header.ticks, replay->header.events,
+				game->options.record_path);
+	}
+	if (replay->mode == REPLAY_PLAY)
+		replay_report(game);
+	free(replay->events);
+	free(replay->frame_us);
+	free(replay->stage_us);
+	ft_memset(replay, 0, sizeof(t_replay));
+}
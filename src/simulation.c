@@ -0,0 +1,99 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   simulation.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:35:58 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 01:44:46 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+#include <math.h>
+
+void	sim_init(t_game *game, int tick_rate)
+{
+	ft_memset(&game->sim, 0, sizeof(t_sim));
+	game->sim.tick = 1.0 / tick_rate;
+	game->sim.prev = game->player;
+	game->camera = game->player;
+}
+
+static void	rescale(double *x, double *y, double length)
+{
+	double	current;
+
+	current = sqrt(*x * *x + *y * *y);
+	if (current <= 0)
+		return ;
+	*x *= length / current;
+	*y *= length / current;
+}
+
+/*
+** Blends the last two simulation states by alpha. Direction and plane are
+** lerped and put back to their lengths, which for the few degrees turned
+** per tick is indistinguishable from a true angular interpolation.
+*/
+static void	interpolate_camera(t_game *game, double alpha)
+{
+	t_player	*a;
+	t_player	*b;
+
+	a = &game->sim.prev;
+	b = &game->player;
+	game->camera.x = a->x + (b->x - a->x) * alpha;
+	game->camera.y = a->y + (b->y - a->y) * alpha;
+	game->camera.dir_x = a->dir_x + (b->dir_x - a->dir_x) * alpha;
+	game->camera.dir_y = a->dir_y + (b->dir_y - a->dir_y) * alpha;
+	game->camera.plane_x = a->plane_x + (b->plane_x - a->plane_x) * alpha;
+	game->camera.plane_y = a->plane_y + (b->plane_y - a->plane_y) * alpha;
+	rescale(&game->camera.dir_x, &game->camera.dir_y,
+		sqrt(b->dir_x * b->dir_x + b->dir_y * b->dir_y));
+	rescale(&game->camera.plane_x, &game->camera.plane_y,
+		sqrt(b->plane_x * b->plane_x + b->plane_y * b->plane_y));
+}
+
+void	sim_step(t_game *game)
+{
+	game->sim.prev = game->player;
+	replay_tick(game);
+	TRACE_BEGIN("process_movement");
+	process_movement(game, game->sim.tick);
+	TRACE_END();
+	game->sim.ticks++;
+}
+
+/*
+** Runs as many fixed ticks as the elapsed time covers. A long stall is
+** clamped to SIM_MAX_FRAME and at most SIM_MAX_STEPS ticks run per frame,
+** so a hitch slows the world down for a moment instead of teleporting
+** the player or spiralling into ever longer catch-up frames. Replays feed
+** exactly one tick per frame.
+*/
+void	sim_advance(t_game *game)
+{
+	t_sim	*sim;
+	double	elapsed;
+	int		steps;
+
+	sim = &game->sim;
+	elapsed = game->time.delta_time;
+	if (game->replay.mode == REPLAY_PLAY)
+		elapsed = sim->tick;
+	if (elapsed > SIM_MAX_FRAME)
+		elapsed = SIM_MAX_FRAME;
+	sim->accumulator += elapsed;
+	steps = 0;
+	while (sim->accumulator >= sim->tick && steps++ < SIM_MAX_STEPS)
+	{
+		sim_step(game);
+		sim->accumulator -= sim->tick;
+	}
+	if (sim->accumulator >= sim->tick)
+		sim->accumulator = fmod(sim->accumulator, sim->tick);
+	sim->alpha = sim->accumulator / sim->tick;
+	interpolate_camera(game, sim->alpha);
+}
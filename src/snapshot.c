@@ -0,0 +1,54 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   snapshot.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:46:50 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 01:46:50 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+void	world_snapshot(t_game *game, t_snapshot *snap)
+{
+	ft_memset(snap, 0, sizeof(t_snapshot));
+	snap->magic = SNAPSHOT_MAGIC;
+	snap->version = SNAPSHOT_VERSION;
+	snap->map_width = game->config.map.width;
+	snap->map_height = game->config.map.height;
+	snap->keys = keys_to_mask(&game->keys);
+	snap->player = game->player;
+	snap->camera = game->camera;
+	snap->sim = game->sim;
+	snap->time = game->time;
+}
+
+/* Returns -1, leaving the world untouched, for a foreign or stale snapshot */
+int	world_restore(t_game *game, const t_snapshot *snap)
+{
+	if (snap->magic != SNAPSHOT_MAGIC || snap->version != SNAPSHOT_VERSION
+		|| snap->map_width != game->config.map.width
+		|| snap->map_height != game->config.map.height)
+		return (-1);
+	mask_to_keys(snap->keys, &game->keys);
+	game->player = snap->player;
+	game->camera = snap->camera;
+	game->sim = snap->sim;
+	game->time = snap->time;
+	return (0);
+}
+
+/*
+** Back to the state right after loading: the spawn comes from the parsed
+** map, so nothing is re-read. The tick rate is kept.
+*/
+void	world_reset(t_game *game)
+{
+	ft_memset(&game->keys, 0, sizeof(t_keys));
+	ft_memset(&game->time, 0, sizeof(t_time));
+	init_player(game);
+	sim_init(game, game->options.tick_rate);
+}
@@ -0,0 +1,122 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   startup.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:25:22 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 02:16:13 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+/* Records why the parser stopped; the main thread exits after the joins */
+static void	*parse_fail(t_startup *s, int code, const char *error)
+{
+	s->code = code;
+	s->error = error;
+	return (NULL);
+}
+
+/*
+** The frontend echoes the parsed config and map. A map that was read but
+** is not closed by walls is still shown before the error.
+*/
+static void	*check_parsed_map(t_startup *s, int status)
+{
+	if (status == 0 || status == -1)
+	{
+		print_config(&s->game->config);
+		print_map(s->game->config.map.grid, s->game->config.map.height);
+	}
+	if (status < 0)
+		return (parse_fail(s, -status, parse_error(status)));
+	return (NULL);
+}
+
+/*
+** The parser owns the garbage collector for the whole startup: it is the
+** only thread that allocates through libgc until everything is joined.
+** It never exits the process itself, the display and the loader are
+** still running.
+*/
+static void	*parse_worker(void *arg)
+{
+	t_startup	*s;
+	int			status;
+
+	s = (t_startup *)arg;
+	TRACE_THREAD("parser");
+	stage_begin(&s->stages[STARTUP_CONFIG]);
+	TRACE_BEGIN("parse_config_header");
+	status = parse_config_header(&s->game->config, s->path);
+	TRACE_END();
+	if (status < 0)
+		return (parse_fail(s, -status, parse_error(status)));
+	stage_end(&s->stages[STARTUP_CONFIG]);
+	stage_begin(&s->stages[STARTUP_TEXTURES]);
+	if (register_wall_textures(s->game) < 0)
+		return (parse_fail(s, 1, "Failed to register texture"));
+	stage_begin(&s->stages[STARTUP_MAP]);
+	TRACE_BEGIN("parse_config_map");
+	status = parse_config_map(&s->game->config, s->path);
+	TRACE_END();
+	stage_end(&s->stages[STARTUP_MAP]);
+	return (check_parsed_map(s, status));
+}
+
+/* Parse errors first, as a serial startup would have reported them */
+static void	check_startup(t_startup *s, int textures)
+{
+	int	display;
+
+	if (s->code != 0)
+		ft_exit(s->code, s->error);
+	display = s->stages[STARTUP_DISPLAY].status;
+	if (display == -1)
+		ft_exit(1, "Failed to initialize MLX");
+	if (display == -2)
+		ft_exit(1, "Failed to create window");
+	if (display < 0)
+		ft_exit(1, "Failed to create image");
+	if (textures < 0)
+		ft_exit(1, "Failed to load texture");
+}
+
+/*
+** Startup runs as a small dependency graph: the parser thread reads the
+** identifiers, queues the wall textures on the texture manager's loader
+** and goes on with the map, while the main thread opens the display (X
+** stays on a single thread). The first frame waits for the prefetched
+** walls; anything evicted later streams back in behind placeholders.
+** Every failure is reported here, once the parser and the queued loads
+** are done.
+*/
+void	run_startup(t_game *game, char *path)
+{
+	t_startup	s;
+	pthread_t	parser;
+	int			textures;
+
+	ft_memset(&s, 0, sizeof(t_startup));
+	s.game = game;
+	s.path = path;
+	if (texmgr_init(&game->texmgr, game->options.texture_budget) < 0)
+		ft_exit(1, "Failed to start texture loader");
+	if (pthread_create(&parser, NULL, parse_worker, &s) != 0)
+		ft_exit(1, "Failed to start parser thread");
+	stage_begin(&s.stages[STARTUP_DISPLAY]);
+	TRACE_BEGIN("init_mlx");
+	s.stages[STARTUP_DISPLAY].status = init_mlx(game);
+	TRACE_END();
+	stage_end(&s.stages[STARTUP_DISPLAY]);
+	pthread_join(parser, NULL);
+	textures = wait_wall_textures(game);
+	stage_end(&s.stages[STARTUP_TEXTURES]);
+	if (s.code == 0)
+		log_startup(&s, game->time.start);
+	check_startup(&s, textures);
+	init_player(game);
+}
@@ -0,0 +1,63 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   startup_utils.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:25:22 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 02:41:40 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+void	stage_begin(t_stage_time *stage)
+{
+	stage->start = get_time_us();
+}
+
+void	stage_end(t_stage_time *stage)
+{
+	stage->end = get_time_us();
+}
+
+static const char	*stage_name(int stage)
+{
+	static const char	*names[STARTUP_COUNT] = {
+		"config", "map", "display", "textures"
+	};
+
+	return (names[stage]);
+}
+
+void	log_startup(t_startup *startup, long t0)
+{
+	int				i;
+	t_stage_time	*stage;
+
+	i = 0;
+	while (i < STARTUP_COUNT)
+	{
+		stage = &startup->stages[i];
+		printf("[startup] %-10s %8.3f -> %8.3f ms (%.3f ms)\n",
+			stage_name(i), (stage->start - t0) / 1000.0,
+			(stage->end - t0) / 1000.0,
+			(stage->end - stage->start) / 1000.0);
+		i++;
+	}
+	printf("[startup] %d texture(s) resident, %zu KiB pinned, "
+		"%zu KiB of %zu KiB budget\n", startup->game->texmgr.count,
+		startup->game->texmgr.pinned / 1024,
+		(startup->game->texmgr.resident - startup->game->texmgr.pinned)
+		/ 1024, startup->game->texmgr.budget / 1024);
+	printf("[startup] ready after %.3f ms\n",
+		(get_time_us() - t0) / 1000.0);
+}
+
+void	log_first_frame(t_game *game)
+{
+	printf("[startup] time to first frame %.3f ms\n",
+		(get_time_us() - game->time.start) / 1000.0);
+	fflush(stdout);
+}
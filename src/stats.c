@@ -0,0 +1,97 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stats.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:45:48 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 02:19:39 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+t_stats	*stats(void)
+{
+	static t_stats	instance;
+
+	return (&instance);
+}
+
+/*
+** Runs when a counting thread exits: its counts move to retired and the
+** block goes back to the pool for the next thread, so short-lived
+** render_batch workers do not use up the slots.
+*/
+void	stats_retire(void *arg)
+{
+	t_stats_block	*block;
+	t_stats			*s;
+	int				stat;
+
+	block = (t_stats_block *)arg;
+	s = stats();
+	pthread_mutex_lock(&s->lock);
+	stat = -1;
+	while (++stat < STAT_COUNT)
+	{
+		s->retired[stat] += block->values[stat];
+		block->values[stat] = 0;
+	}
+	block->owned = 0;
+	pthread_mutex_unlock(&s->lock);
+}
+
+/* A free block from the pool, or a new one while there is room */
+static t_stats_block	*stats_claim(t_stats *s)
+{
+	t_stats_block	*block;
+	int				i;
+
+	block = NULL;
+	pthread_mutex_lock(&s->lock);
+	i = 0;
+	while (i < STATS_MAX_THREADS && s->blocks[i] && s->blocks[i]->owned)
+		i++;
+	if (i < STATS_MAX_THREADS && !s->blocks[i])
+		s->blocks[i] = ft_calloc(1, sizeof(t_stats_block));
+	if (i < STATS_MAX_THREADS)
+		block = s->blocks[i];
+	if (block)
+		block->owned = 1;
+	pthread_mutex_unlock(&s->lock);
+	if (block)
+		pthread_setspecific(s->key, block);
+	return (block);
+}
+
+static t_stats_block	*stats_local(void)
+{
+	static __thread t_stats_block	*block;
+	static __thread int				refused;
+
+	if (block || refused)
+		return (block);
+	block = stats_claim(stats());
+	refused = (block == NULL);
+	return (block);
+}
+
+/*
+** Hot loops count into locals and call this once per column or ray, so
+** the cost is one thread-local lookup and an uncontended store. Without
+** --stats nothing is counted.
+*/
+void	stats_add(int stat, unsigned long n)
+{
+	t_stats_block	*block;
+
+	if (!stats()->page)
+		return ;
+	block = stats_local();
+	if (!block)
+		return ;
+	__atomic_store_n(&block->values[stat], block->values[stat] + n,
+		__ATOMIC_RELAXED);
+}
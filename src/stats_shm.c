@@ -0,0 +1,115 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stats_shm.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:45:48 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 02:19:39 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+
+int	stats_open(void)
+{
+	t_stats_page	*page;
+	int				fd;
+
+	fd = shm_open(STATS_SHM_NAME, O_CREAT | O_RDWR, 0644);
+	if (fd < 0)
+		return (-1);
+	if (ftruncate(fd, sizeof(t_stats_page)) < 0)
+	{
+		close(fd);
+		return (-1);
+	}
+	page = mmap(NULL, sizeof(t_stats_page), PROT_READ | PROT_WRITE,
+			MAP_SHARED, fd, 0);
+	close(fd);
+	if (page == MAP_FAILED)
+		return (-1);
+	if (pthread_mutex_init(&stats()->lock, NULL) != 0
+		|| pthread_key_create(&stats()->key, stats_retire) != 0)
+		return (munmap(page, sizeof(t_stats_page)), -1);
+	ft_memset(page, 0, sizeof(t_stats_page));
+	page->magic = STATS_SHM_MAGIC;
+	page->version = STATS_SHM_VERSION;
+	page->pid = getpid();
+	stats()->page = page;
+	return (0);
+}
+
+static void	stats_sum(unsigned long *total)
+{
+	t_stats_block	*block;
+	int				i;
+	int				stat;
+
+	pthread_mutex_lock(&stats()->lock);
+	ft_memcpy(total, stats()->retired, sizeof(unsigned long) * STAT_COUNT);
+	i = -1;
+	while (++i < STATS_MAX_THREADS)
+	{
+		block = stats()->blocks[i];
+		stat = -1;
+		while (block && ++stat < STAT_COUNT)
+			total[stat] += __atomic_load_n(&block->values[stat],
+					__ATOMIC_RELAXED);
+	}
+	pthread_mutex_unlock(&stats()->lock);
+}
+
+/*
+** Seqlock writer: bump seq to odd, write, bump back to even. The fences
+** keep the payload stores inside the odd window for readers on any core.
+*/
+void	stats_publish(t_game *game)
+{
+	t_stats_page	*page;
+	unsigned long	total[STAT_COUNT];
+	int				stat;
+
+	page = stats()->page;
+	if (!page)
+		return ;
+	stats_sum(total);
+	__atomic_store_n(&page->seq, page->seq + 1, __ATOMIC_RELAXED);
+	__atomic_thread_fence(__ATOMIC_RELEASE);
+	page->frame = game->time.frame_count;
+	stat = -1;
+	while (++stat < STAT_COUNT)
+	{
+		page->last[stat] = total[stat] - stats()->previous[stat];
+		page->total[stat] = total[stat];
+		stats()->previous[stat] = total[stat];
+	}
+	page->frame_ms = game->time.delta_time * 1000.0;
+	page->present_ms = (game->hud.stages[FRAME_PRESENT].end
+			- game->hud.stages[FRAME_PRESENT].start) / 1000.0;
+	__atomic_store_n(&page->seq, page->seq + 1, __ATOMIC_RELEASE);
+}
+
+void	stats_close(void)
+{
+	t_stats	*s;
+	int		i;
+
+	s = stats();
+	if (!s->page)
+		return ;
+	munmap(s->page, sizeof(t_stats_page));
+	shm_unlink(STATS_SHM_NAME);
+	s->page = NULL;
+	pthread_key_delete(s->key);
+	pthread_mutex_destroy(&s->lock);
+	i = -1;
+	while (++i < STATS_MAX_THREADS)
+	{
+		free(s->blocks[i]);
+		s->blocks[i] = NULL;
+	}
+}
@@ -0,0 +1,133 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   texture_cache.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:23:08 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 02:40:36 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+static int	texcache_matches(const t_texcache_header *hdr,
+	const struct stat *src, const char *path, size_t len)
+{
+	if (len < sizeof(t_texcache_header))
+		return (0);
+	if (hdr->magic != TEXCACHE_MAGIC || hdr->version != TEXCACHE_VERSION)
+		return (0);
+	if (hdr->src_mtime != (long)src->st_mtim.tv_sec
+		|| hdr->src_mtime_ns != (long)src->st_mtim.tv_nsec
+		|| hdr->src_size != (long)src->st_size)
+		return (0);
+	if (ft_strncmp(hdr->path, path, TEXCACHE_PATH_MAX) != 0)
+		return (0);
+	if (hdr->width <= 0 || hdr->height <= 0)
+		return (0);
+	if (hdr->format == TEXCACHE_INDEXED
+		&& (hdr->colors <= 0 || hdr->colors > TEX_PALETTE_SIZE))
+		return (0);
+	return (len == sizeof(t_texcache_header)
+		+ texcache_payload_size(hdr->format, hdr->width, hdr->height));
+}
+
+static void	texcache_bind(t_tex_source *texture, t_texcache_header *hdr,
+	size_t len)
+{
+	texture->cache_map = hdr;
+	texture->cache_len = len;
+	texture->width = hdr->width;
+	texture->height = hdr->height;
+	if (hdr->format == TEXCACHE_INDEXED)
+	{
+		texture->colors = hdr->colors;
+		texture->palette = (unsigned int *)(hdr + 1);
+		texture->indices = (unsigned char *)(texture->palette
+				+ TEX_PALETTE_SIZE);
+		return ;
+	}
+	texture->img = (t_image){NULL, (char *)(hdr + 1), 32, hdr->width * 4, 0};
+}
+
+int	texcache_load(t_tex_source *texture, const char *path)
+{
+	char				cache_path[TEXCACHE_NAME_MAX];
+	struct stat			src;
+	struct stat			st;
+	int					fd;
+	t_texcache_header	*hdr;
+
+	if (stat(path, &src) < 0)
+		return (-1);
+	texcache_path(cache_path, path);
+	fd = open(cache_path, O_RDONLY);
+	if (fd < 0)
+		return (-1);
+	hdr = MAP_FAILED;
+	if (fstat(fd, &st) == 0 && st.st_size >= (off_t)sizeof(*hdr))
+		hdr = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE | MAP_POPULATE,
+				fd, 0);
+	close(fd);
+	if (hdr == MAP_FAILED)
+		return (-1);
+	if (!texcache_matches(hdr, &src, path, st.st_size))
+		return (munmap(hdr, st.st_size), -1);
+	texcache_bind(texture, hdr, st.st_size);
+	return (0);
+}
+
+static int	texcache_fill_header(t_texcache_header *hdr,
+	t_tex_source *texture, const char *path)
+{
+	struct stat	src;
+
+	if (stat(path, &src) < 0 || ft_strlen(path) >= TEXCACHE_PATH_MAX)
+		return (-1);
+	ft_memset(hdr, 0, sizeof(t_texcache_header));
+	hdr->magic = TEXCACHE_MAGIC;
+	hdr->version = TEXCACHE_VERSION;
+	hdr->width = texture->width;
+	hdr->height = texture->height;
+	hdr->src_mtime = src.st_mtim.tv_sec;
+	hdr->src_mtime_ns = src.st_mtim.tv_nsec;
+	hdr->src_size = src.st_size;
+	hdr->format = TEXCACHE_BGRA;
+	if (texture->colors > 0)
+		hdr->format = TEXCACHE_INDEXED;
+	hdr->colors = texture->colors;
+	ft_strlcpy(hdr->path, path, TEXCACHE_PATH_MAX);
+	return (0);
+}
+
+int	texcache_store(t_tex_source *texture, const char *path)
+{
+	t_texcache_header	hdr;
+	char				cache_path[TEXCACHE_NAME_MAX];
+	char				tmp_path[TEXCACHE_NAME_MAX];
+	int					fd;
+
+	if (texture->colors == 0 && (texture->img.bits_per_pixel != 32
+			|| texture->img.endian != 0))
+		return (-1);
+	if (texcache_fill_header(&hdr, texture, path) < 0)
+		return (-1);
+	mkdir(TEXCACHE_DIR, 0755);
+	texcache_path(cache_path, path);
+	ft_strlcpy(tmp_path, cache_path, TEXCACHE_NAME_MAX);
+	ft_strlcat(tmp_path, ".tmp", TEXCACHE_NAME_MAX);
+	fd = open(tmp_path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if (fd < 0)
+		return (-1);
+	if (texcache_write_all(fd, &hdr, sizeof(hdr)) < 0
+		|| texcache_write_pixels(fd, texture) < 0)
+		return (close(fd), unlink(tmp_path), -1);
+	close(fd);
+	if (rename(tmp_path, cache_path) < 0)
+		return (unlink(tmp_path), -1);
+	return (0);
+}
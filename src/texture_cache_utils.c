@@ -0,0 +1,93 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   texture_cache_utils.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:23:08 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 00:29:07 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+static unsigned long	texcache_hash(const char *s)
+{
+	unsigned long	hash;
+
+	hash = 14695981039346656037UL;
+	while (*s)
+	{
+		hash ^= (unsigned char)*s++;
+		hash *= 1099511628211UL;
+	}
+	return (hash);
+}
+
+/*
+** Cache files are named after a hash of the source path so that any
+** number of textures can share the cache directory.
+*/
+void	texcache_path(char *dst, const char *src)
+{
+	unsigned long	hash;
+	size_t			len;
+	int				i;
+
+	len = ft_strlcpy(dst, TEXCACHE_DIR "/", TEXCACHE_NAME_MAX);
+	hash = texcache_hash(src);
+	i = 16;
+	while (i-- > 0)
+	{
+		dst[len + i] = "0123456789abcdef"[hash & 0xF];
+		hash >>= 4;
+	}
+	ft_strlcpy(dst + len + 16, TEXCACHE_EXT, TEXCACHE_NAME_MAX - len - 16);
+}
+
+int	texcache_write_all(int fd, const void *buf, size_t len)
+{
+	ssize_t	written;
+
+	while (len > 0)
+	{
+		written = write(fd, buf, len);
+		if (written <= 0)
+			return (-1);
+		buf = (const char *)buf + written;
+		len -= written;
+	}
+	return (0);
+}
+
+size_t	texcache_payload_size(int format, int width, int height)
+{
+	if (format == TEXCACHE_INDEXED)
+		return (TEX_PALETTE_SIZE * sizeof(unsigned int)
+			+ (size_t)width * height);
+	return ((size_t)width * height * sizeof(unsigned int));
+}
+
+/*
+** Indexed images are written as the full palette followed by the index
+** rows, BGRA images as their pixel rows without the line padding.
+*/
+int	texcache_write_pixels(int fd, t_tex_source *texture)
+{
+	int	y;
+
+	if (texture->colors > 0)
+		return (texcache_write_all(fd, texture->palette,
+				texcache_payload_size(TEXCACHE_INDEXED, texture->width,
+					texture->height)));
+	y = 0;
+	while (y < texture->height)
+	{
+		if (texcache_write_all(fd, texture->img.addr
+				+ y * texture->img.line_length, texture->width * 4) < 0)
+			return (-1);
+		y++;
+	}
+	return (0);
+}
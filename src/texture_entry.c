@@ -0,0 +1,89 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   texture_entry.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 02:17:32 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 02:40:36 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+static size_t	tex_align(size_t bytes)
+{
+	return ((bytes + TEXTURE_ALIGN - 1) & ~((size_t)TEXTURE_ALIGN - 1));
+}
+
+/*
+** Bytes to allocate to hold source as a renderer texture: palettized
+** entries carry their palette and its shaded copy in front of the index
+** rows. A cache mapping is used in place, so only the palettes are needed.
+*/
+size_t	tex_entry_size(t_tex_source *source)
+{
+	size_t	texels;
+
+	texels = (size_t)source->width * source->height;
+	if (source->cache_map && source->colors > 0)
+		return (2 * TEX_PALETTE_SIZE * sizeof(unsigned int));
+	if (source->cache_map)
+		return (0);
+	if (source->colors > 0)
+		return (2 * TEX_PALETTE_SIZE * sizeof(unsigned int)
+			+ tex_align(texels));
+	return (tex_align(texels * sizeof(unsigned int)));
+}
+
+/*
+** The pre-shaded palette copy is used for y-side walls, so shading costs
+** 256 operations instead of one per pixel.
+*/
+static void	tex_copy_indexed(t_texture *dst, t_tex_source *source)
+{
+	int	i;
+
+	dst->palette = (unsigned int *)dst->pixels;
+	dst->shaded = dst->palette + TEX_PALETTE_SIZE;
+	dst->indices = (unsigned char *)(dst->shaded + TEX_PALETTE_SIZE);
+	dst->pixels = NULL;
+	i = -1;
+	while (++i < TEX_PALETTE_SIZE)
+	{
+		dst->palette[i] = source->palette[i];
+		dst->shaded[i] = (source->palette[i] >> 1) & 8355711;
+	}
+	if (source->cache_map)
+		dst->indices = source->indices;
+	else
+		ft_memcpy(dst->indices, source->indices,
+			(size_t)source->width * source->height);
+}
+
+void	tex_entry_fill(t_texture *dst, void *mem, t_tex_source *source)
+{
+	int	y;
+
+	*dst = (t_texture){mem, NULL, NULL, NULL, source->width,
+		source->height};
+	if (source->colors > 0)
+	{
+		tex_copy_indexed(dst, source);
+		return ;
+	}
+	if (source->cache_map)
+	{
+		dst->pixels = (unsigned int *)source->img.addr;
+		return ;
+	}
+	y = 0;
+	while (y < source->height)
+	{
+		ft_memcpy(dst->pixels + (size_t)y * source->width,
+			source->img.addr + (size_t)y * source->img.line_length,
+			source->width * sizeof(unsigned int));
+		y++;
+	}
+}
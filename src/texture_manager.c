@@ -0,0 +1,119 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   texture_manager.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:33:33 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 02:41:40 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+int	texmgr_init(t_texmgr *mgr, size_t budget)
+{
+	ft_memset(mgr, 0, sizeof(t_texmgr));
+	mgr->budget = budget;
+	mgr->fallback_pixel = TEXMGR_FALLBACK_COLOR;
+	mgr->fallback = (t_texture){&mgr->fallback_pixel, NULL, NULL, NULL, 1,
+		1};
+	mgr->placeholders.size = TEXMGR_MAX_SLOTS * TEXMGR_PLACEHOLDER_SIZE
+		* TEXMGR_PLACEHOLDER_SIZE * sizeof(unsigned int);
+	mgr->placeholders.data = aligned_alloc(TEXTURE_ALIGN,
+			mgr->placeholders.size);
+	if (!mgr->placeholders.data)
+		return (-1);
+	mem_account(MEM_TEXTURES, mgr->placeholders.size);
+	if (pthread_mutex_init(&mgr->lock, NULL) != 0
+		|| pthread_cond_init(&mgr->wake, NULL) != 0
+		|| pthread_cond_init(&mgr->done, NULL) != 0)
+		return (-1);
+	return (texmgr_start(mgr));
+}
+
+/*
+** Handles are stable for the lifetime of the manager. Paths that resolve
+** to the same file share a handle, which stays pinned once any of its
+** registrations asked for it.
+*/
+int	texmgr_register(t_texmgr *mgr, const char *path, int pinned)
+{
+	char	canon[PATH_MAX];
+	int		i;
+
+	if (!realpath(path, canon))
+		ft_strlcpy(canon, path, PATH_MAX);
+	i = 0;
+	while (i < mgr->count && ft_strcmp(mgr->slots[i].path, canon) != 0)
+		i++;
+	if (i == TEXMGR_MAX_SLOTS)
+		return (-1);
+	if (i == mgr->count)
+	{
+		mgr->slots[i].path = ft_strdup(canon);
+		if (!mgr->slots[i].path)
+			return (-1);
+		mgr->count++;
+	}
+	mgr->slots[i].pinned |= pinned;
+	return (i);
+}
+
+/*
+** Called from the ray pass for every column. A texture that is not
+** resident is queued for the loader and its placeholder (or a flat
+** fallback until the first load finishes) is drawn instead.
+*/
+t_texture	*texmgr_get(t_texmgr *mgr, int handle)
+{
+	t_tex_slot	*slot;
+	int			state;
+
+	slot = &mgr->slots[handle];
+	state = __atomic_load_n(&slot->state, __ATOMIC_ACQUIRE);
+	if (state == SLOT_RESIDENT)
+	{
+		slot->last_used = mgr->frame;
+		return (&slot->texture);
+	}
+	if (state == SLOT_UNLOADED)
+		texmgr_request(mgr, handle);
+	if (__atomic_load_n(&slot->has_placeholder, __ATOMIC_ACQUIRE))
+		return (&slot->placeholder);
+	return (&mgr->fallback);
+}
+
+void	texmgr_request(t_texmgr *mgr, int handle)
+{
+	int	expected;
+
+	expected = SLOT_UNLOADED;
+	if (!__atomic_compare_exchange_n(&mgr->slots[handle].state, &expected,
+			SLOT_QUEUED, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+		return ;
+	pthread_mutex_lock(&mgr->lock);
+	mgr->queue[mgr->tail++ % TEXMGR_MAX_SLOTS] = handle;
+	pthread_cond_signal(&mgr->wake);
+	pthread_mutex_unlock(&mgr->lock);
+}
+
+void	texmgr_destroy(t_texmgr *mgr)
+{
+	int	i;
+
+	texmgr_stop(mgr);
+	i = -1;
+	while (++i < mgr->count)
+	{
+		texmgr_release(mgr, &mgr->slots[i]);
+		free(mgr->slots[i].path);
+		mgr->slots[i].path = NULL;
+	}
+	mgr->count = 0;
+	if (mgr->placeholders.data)
+		mem_account(MEM_TEXTURES, -(long)mgr->placeholders.size);
+	free(mgr->placeholders.data);
+	mgr->placeholders.data = NULL;
+}
@@ -0,0 +1,118 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   texture_manager_evict.c                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:33:33 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 02:41:40 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+#include <sys/mman.h>
+
+static int	texmgr_oldest(t_texmgr *mgr)
+{
+	int	oldest;
+	int	i;
+
+	oldest = -1;
+	i = -1;
+	while (++i < mgr->count)
+	{
+		if (__atomic_load_n(&mgr->slots[i].state, __ATOMIC_ACQUIRE)
+			!= SLOT_RESIDENT || mgr->slots[i].last_used >= mgr->frame
+			|| mgr->slots[i].pinned)
+			continue ;
+		if (oldest < 0
+			|| mgr->slots[i].last_used < mgr->slots[oldest].last_used)
+			oldest = i;
+	}
+	return (oldest);
+}
+
+void	texmgr_release(t_texmgr *mgr, t_tex_slot *slot)
+{
+	if (!slot->data && !slot->map)
+		return ;
+	mem_account(MEM_TEXTURES, -(long)slot->bytes);
+	free(slot->data);
+	slot->data = NULL;
+	if (slot->map)
+		munmap(slot->map, slot->map_len);
+	slot->map = NULL;
+	__atomic_sub_fetch(&mgr->resident, slot->bytes, __ATOMIC_RELAXED);
+	if (slot->pinned)
+		__atomic_sub_fetch(&mgr->pinned, slot->bytes, __ATOMIC_RELAXED);
+}
+
+/*
+** Only the main thread flips RESIDENT slots back to UNLOADED, between
+** frames, so the renderer never sees its texture freed under it. Slots
+** touched this frame are never evicted even when over budget. Pinned
+** bytes sit on top of the budget, which only caps the rest.
+*/
+static void	texmgr_evict(t_texmgr *mgr)
+{
+	t_tex_slot	*slot;
+	int			victim;
+
+	while (__atomic_load_n(&mgr->resident, __ATOMIC_ACQUIRE)
+		> mgr->budget + __atomic_load_n(&mgr->pinned, __ATOMIC_RELAXED))
+	{
+		victim = texmgr_oldest(mgr);
+		if (victim < 0)
+			return ;
+		slot = &mgr->slots[victim];
+		__atomic_store_n(&slot->state, SLOT_UNLOADED, __ATOMIC_RELEASE);
+		texmgr_release(mgr, slot);
+		log_line("[texture] evicted %s (%zu KiB)", slot->path,
+			slot->bytes / 1024);
+	}
+}
+
+/*
+** A texture that fails to stream in mid-game keeps its placeholder (or the
+** flat fallback). It is reported once and parked as SLOT_BROKEN, which
+** texmgr_get never queues again.
+*/
+void	texmgr_update(t_texmgr *mgr)
+{
+	int	i;
+
+	i = -1;
+	while (++i < mgr->count)
+	{
+		if (__atomic_load_n(&mgr->slots[i].state, __ATOMIC_ACQUIRE)
+			!= SLOT_FAILED)
+			continue ;
+		__atomic_store_n(&mgr->slots[i].state, SLOT_BROKEN, __ATOMIC_RELEASE);
+		log_line("[texture] failed to load %s, keeping its placeholder",
+			mgr->slots[i].path);
+	}
+	texmgr_evict(mgr);
+	mgr->frame++;
+}
+
+/*
+** Blocks until handle has left the load queue. Only used at startup, where
+** the first frame should not be drawn with placeholders.
+*/
+int	texmgr_wait(t_texmgr *mgr, int handle)
+{
+	int	state;
+
+	pthread_mutex_lock(&mgr->lock);
+	state = __atomic_load_n(&mgr->slots[handle].state, __ATOMIC_ACQUIRE);
+	while (state == SLOT_QUEUED)
+	{
+		pthread_cond_wait(&mgr->done, &mgr->lock);
+		state = __atomic_load_n(&mgr->slots[handle].state, __ATOMIC_ACQUIRE);
+	}
+	pthread_mutex_unlock(&mgr->lock);
+	if (state == SLOT_FAILED || state == SLOT_BROKEN)
+		return (-1);
+	return (0);
+}
@@ -0,0 +1,119 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   texture_manager_loader.c                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:33:33 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 02:41:40 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+static int	texmgr_next(t_texmgr *mgr)
+{
+	int	handle;
+
+	pthread_mutex_lock(&mgr->lock);
+	while (!mgr->quit && mgr->head == mgr->tail)
+		pthread_cond_wait(&mgr->wake, &mgr->lock);
+	handle = -1;
+	if (!mgr->quit)
+		handle = mgr->queue[mgr->head++ % TEXMGR_MAX_SLOTS];
+	pthread_mutex_unlock(&mgr->lock);
+	return (handle);
+}
+
+static void	texmgr_publish(t_texmgr *mgr, t_tex_slot *slot, int state,
+	long start)
+{
+	if (state == SLOT_RESIDENT)
+		log_line("[texture] %s %dx%d, %zu KiB in %.3f ms", slot->path,
+			slot->texture.width, slot->texture.height,
+			slot->bytes / 1024, (get_time_us() - start) / 1000.0);
+	pthread_mutex_lock(&mgr->lock);
+	__atomic_store_n(&slot->state, state, __ATOMIC_RELEASE);
+	pthread_cond_broadcast(&mgr->done);
+	pthread_mutex_unlock(&mgr->lock);
+}
+
+static void	texmgr_make_placeholder(t_texmgr *mgr, int handle,
+	t_tex_source *source)
+{
+	t_tex_slot	*slot;
+	size_t		offset;
+
+	slot = &mgr->slots[handle];
+	offset = (size_t)handle * TEXMGR_PLACEHOLDER_SIZE
+		* TEXMGR_PLACEHOLDER_SIZE * sizeof(unsigned int);
+	tex_placeholder_fill(&slot->placeholder,
+		mgr->placeholders.data + offset, source);
+	__atomic_store_n(&slot->has_placeholder, 1, __ATOMIC_RELEASE);
+}
+
+/*
+** A cache hit is drawn straight from its mapping: the slot takes it over
+** and unload_texture leaves it alone. Only a freshly decoded XPM, or an
+** indexed texture's palette pair, is copied into data.
+*/
+static int	texmgr_load_slot(t_texmgr *mgr, t_tex_slot *slot, int handle)
+{
+	t_tex_source	source;
+
+	ft_memset(&source, 0, sizeof(t_tex_source));
+	if (load_texture(&source, slot->path) < 0)
+		return (-1);
+	slot->bytes = tex_entry_size(&source);
+	slot->data = NULL;
+	if (slot->bytes > 0)
+		slot->data = aligned_alloc(TEXTURE_ALIGN, slot->bytes);
+	if (slot->bytes > 0 && !slot->data)
+		return (unload_texture(&source), -1);
+	mem_account(MEM_TEXTURES, slot->bytes);
+	tex_entry_fill(&slot->texture, slot->data, &source);
+	if (!slot->has_placeholder)
+		texmgr_make_placeholder(mgr, handle, &source);
+	slot->map = source.cache_map;
+	slot->map_len = source.cache_len;
+	slot->bytes += source.cache_len;
+	source.cache_map = NULL;
+	unload_texture(&source);
+	if (slot->pinned)
+		__atomic_add_fetch(&mgr->pinned, slot->bytes, __ATOMIC_RELAXED);
+	__atomic_add_fetch(&mgr->resident, slot->bytes, __ATOMIC_RELEASE);
+	return (0);
+}
+
+/*
+** Loader thread: takes queued textures one at a time so the frame loop
+** never waits on disk or on XPM parsing. TEXMGR_LOADERS of them share
+** the queue.
+*/
+void	*texmgr_loader(void *arg)
+{
+	t_texmgr	*mgr;
+	t_tex_slot	*slot;
+	long		start;
+	int			status;
+	int			handle;
+
+	mgr = (t_texmgr *)arg;
+	TRACE_THREAD("texture loader");
+	handle = texmgr_next(mgr);
+	while (handle >= 0)
+	{
+		slot = &mgr->slots[handle];
+		start = get_time_us();
+		TRACE_BEGIN("load_texture");
+		status = texmgr_load_slot(mgr, slot, handle);
+		TRACE_END();
+		if (status < 0)
+			texmgr_publish(mgr, slot, SLOT_FAILED, start);
+		else
+			texmgr_publish(mgr, slot, SLOT_RESIDENT, start);
+		handle = texmgr_next(mgr);
+	}
+	return (NULL);
+}
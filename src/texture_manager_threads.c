@@ -0,0 +1,43 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   texture_manager_threads.c                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 02:38:36 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 02:38:36 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+/*
+** Starts the loader pool. The four walls are queued together at startup,
+** so each one gets its own decode thread like the per-texture jobs of the
+** serial startup had. running counts the threads to join, also when one
+** of them fails to start.
+*/
+int	texmgr_start(t_texmgr *mgr)
+{
+	while (mgr->running < TEXMGR_LOADERS)
+	{
+		if (pthread_create(&mgr->loaders[mgr->running], NULL, texmgr_loader,
+				mgr) != 0)
+			return (-1);
+		mgr->running++;
+	}
+	return (0);
+}
+
+void	texmgr_stop(t_texmgr *mgr)
+{
+	if (!mgr->running)
+		return ;
+	pthread_mutex_lock(&mgr->lock);
+	mgr->quit = 1;
+	pthread_cond_broadcast(&mgr->wake);
+	pthread_mutex_unlock(&mgr->lock);
+	while (mgr->running > 0)
+		pthread_join(mgr->loaders[--mgr->running], NULL);
+}
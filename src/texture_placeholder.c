@@ -0,0 +1,51 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   texture_placeholder.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:33:33 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 02:18:02 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+static unsigned int	source_texel(t_tex_source *source, int x, int y)
+{
+	if (source->colors > 0)
+		return (source->palette[source->indices[y * source->width + x]]);
+	return (*(unsigned int *)(source->img.addr + y * source->img.line_length
+		+ x * sizeof(unsigned int)));
+}
+
+/*
+** Point-samples source down to at most TEXMGR_PLACEHOLDER_SIZE texels per
+** side, stored as plain pixels in a fixed-size cell of the
+** placeholder pool.
+*/
+void	tex_placeholder_fill(t_texture *dst, void *mem, t_tex_source *source)
+{
+	int	width;
+	int	height;
+	int	x;
+	int	y;
+
+	width = source->width;
+	if (width > TEXMGR_PLACEHOLDER_SIZE)
+		width = TEXMGR_PLACEHOLDER_SIZE;
+	height = source->height;
+	if (height > TEXMGR_PLACEHOLDER_SIZE)
+		height = TEXMGR_PLACEHOLDER_SIZE;
+	*dst = (t_texture){mem, NULL, NULL, NULL, width, height};
+	y = -1;
+	while (++y < height)
+	{
+		x = -1;
+		while (++x < width)
+			dst->pixels[y * width + x] = source_texel(source,
+					(2 * x + 1) * source->width / (2 * width),
+					(2 * y + 1) * source->height / (2 * height));
+	}
+}
@@ -0,0 +1,59 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   texture_walls.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:33:33 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 02:41:40 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+/*
+** Hands the four wall paths to the texture manager and queues them right
+** away, so decoding overlaps with the rest of the map parse. They are
+** pinned: every view draws them, so evicting one would only bring its
+** placeholder on screen until the reload lands.
+*/
+int	register_wall_textures(t_game *game)
+{
+	char	*paths[4];
+	int		face;
+
+	paths[NORTH] = game->config.textures.north;
+	paths[SOUTH] = game->config.textures.south;
+	paths[WEST] = game->config.textures.west;
+	paths[EAST] = game->config.textures.east;
+	face = -1;
+	while (++face < 4)
+	{
+		game->wall_tex[face] = texmgr_register(&game->texmgr, paths[face],
+				1);
+		if (game->wall_tex[face] < 0)
+			return (-1);
+		texmgr_request(&game->texmgr, game->wall_tex[face]);
+	}
+	return (0);
+}
+
+/*
+** Waits for everything queued so far: the four walls, or fewer when the
+** startup stopped half way through registering them.
+*/
+int	wait_wall_textures(t_game *game)
+{
+	int	status;
+	int	i;
+
+	TRACE_BEGIN("wait_wall_textures");
+	status = 0;
+	i = -1;
+	while (++i < game->texmgr.count)
+		if (texmgr_wait(&game->texmgr, i) < 0)
+			status = -1;
+	TRACE_END();
+	return (status);
+}
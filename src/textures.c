@@ -6,39 +6,66 @@
 /*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/23 00:00:00 by ataher            #+#    #+#             */
-/*   Updated: 2025/11/23 22:43:07 by ataher           ###   ########.fr       */
+/*   Updated: 2026/10/19 00:49:38 by ataher           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "cub3d.h"
+#include <sys/mman.h>
 
-static void	load_texture(t_game *game, t_texture *texture, char *path)
+static long	source_bytes(t_tex_source *texture)
 {
-	texture->img.img = mlx_xpm_file_to_image(game->mlx, path,
-			&texture->width, &texture->height);
-	if (!texture->img.img)
-		ft_exit(1, "Failed to load texture");
-	texture->img.addr = mlx_get_data_addr(texture->img.img,
-			&texture->img.bits_per_pixel,
-			&texture->img.line_length,
-			&texture->img.endian);
+	int	format;
+
+	if (texture->cache_map)
+		return (texture->cache_len);
+	format = TEXCACHE_BGRA;
+	if (texture->colors > 0)
+		format = TEXCACHE_INDEXED;
+	return (texcache_payload_size(format, texture->width, texture->height));
 }
 
-void	load_textures(t_game *game)
+/*
+** Textures are mapped straight from the decoded cache when it is still
+** valid for the XPM on disk. Otherwise the XPM is decoded and the cache is
+** regenerated for the next start. Nothing here touches MLX, so textures
+** can load on worker threads while the display is being opened.
+*/
+int	load_texture(t_tex_source *texture, char *path)
 {
-	load_texture(game, &game->textures[NORTH], game->config.textures.north);
-	load_texture(game, &game->textures[SOUTH], game->config.textures.south);
-	load_texture(game, &game->textures[WEST], game->config.textures.west);
-	load_texture(game, &game->textures[EAST], game->config.textures.east);
+	if (texcache_load(texture, path) == 0)
+	{
+		mem_account(MEM_TEXTURES, source_bytes(texture));
+		return (0);
+	}
+	if (xpm_decode(texture, path) < 0)
+		return (-1);
+	mem_account(MEM_TEXTURES, source_bytes(texture));
+	texcache_store(texture, path);
+	return (0);
 }
 
-int	get_texture_color(t_texture *texture, int x, int y)
+void	unload_texture(t_tex_source *texture)
 {
-	char	*pixel;
+	if (texture->cache_map || texture->heap)
+		mem_account(MEM_TEXTURES, -source_bytes(texture));
+	if (texture->cache_map)
+		munmap(texture->cache_map, texture->cache_len);
+	free(texture->heap);
+	texture->cache_map = NULL;
+	texture->heap = NULL;
+}
 
+void	destroy_textures(t_game *game)
+{
+	texmgr_destroy(&game->texmgr);
+}
+
+int	get_texture_color(t_texture *texture, int x, int y)
+{
 	if (x < 0 || x >= texture->width || y < 0 || y >= texture->height)
 		return (0);
-	pixel = texture->img.addr + (y * texture->img.line_length
-			+ x * (texture->img.bits_per_pixel / 8));
-	return (*(int *)pixel);
+	if (texture->indices)
+		return (texture->palette[texture->indices[y * texture->width + x]]);
+	return (texture->pixels[y * texture->width + x]);
 }
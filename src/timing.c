@@ -6,20 +6,20 @@
 /*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/23 00:00:00 by ataher            #+#    #+#             */
-/*   Updated: 2025/11/23 22:24:26 by ataher           ###   ########.fr       */
+/*   Updated: 2026/10/19 01:04:18 by ataher           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "cub3d.h"
-#include <sys/time.h>
-#include <unistd.h>
+#include <sched.h>
+#include <time.h>
 
 long	get_time_us(void)
 {
-	struct timeval	tv;
+	struct timespec	ts;
 
-	gettimeofday(&tv, NULL);
-	return (tv.tv_sec * 1000000 + tv.tv_usec);
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * 1000000 + ts.tv_nsec / 1000);
 }
 
 void	update_delta_time(t_game *game)
@@ -33,17 +33,55 @@ void	update_delta_time(t_game *game)
 	game->time.last_frame = current_time;
 }
 
+static void	sleep_until(long deadline_us)
+{
+	struct timespec	ts;
+
+	ts.tv_sec = deadline_us / 1000000;
+	ts.tv_nsec = (deadline_us % 1000000) * 1000;
+	while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) != 0)
+		;
+}
+
+/*
+** Sleeps to PACER_SPIN_US before the deadline, then yields until it is
+** reached: the kernel may oversleep by a scheduler tick, the spin does
+** not.
+*/
+void	pacer_wait(long deadline)
+{
+	if (deadline - get_time_us() > PACER_SPIN_US)
+		sleep_until(deadline - PACER_SPIN_US);
+	while (get_time_us() < deadline)
+		sched_yield();
+}
+
+/*
+** Deadlines advance by a fixed period so errors do not accumulate; after
+** a missed frame the schedule restarts from now instead of bursting to
+** catch up. With --low-latency the wait already happened before the
+** update (pacer_wait_late), so only the schedule and the work estimate
+** move here.
+*/
 void	cap_framerate(t_game *game)
 {
-	long	current_time;
-	long	elapsed;
-	long	sleep_time;
+	t_pacer	*pacer;
+	long	now;
 
-	current_time = get_time_us();
-	elapsed = current_time - game->time.last_frame;
-	if (elapsed < FRAME_TIME_US)
+	pacer = &game->pacer;
+	if (pacer->period > 0 && !game->options.low_latency)
+		pacer_wait(pacer->deadline);
+	now = get_time_us();
+	if (pacer->wake)
+		pacer->work += (now - pacer->wake - pacer->work) / 8;
+	if (pacer->period > 0)
 	{
-		sleep_time = FRAME_TIME_US - elapsed;
-		usleep(sleep_time);
+		pacer->deadline += pacer->period;
+		if (pacer->deadline <= now)
+		{
+			pacer->deadline = now + pacer->period;
+			pacer->missed++;
+		}
 	}
+	pacer_record(pacer, now);
 }
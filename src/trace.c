@@ -0,0 +1,75 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   trace.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:42:45 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 00:42:45 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+t_tracer	*tracer(void)
+{
+	static t_tracer	instance;
+
+	return (&instance);
+}
+
+/*
+** Returns the calling thread's ring, creating and registering it on first
+** use. name only matters for that first call. NULL once every slot is
+** taken, in which case the thread simply is not traced.
+*/
+t_trace_ring	*trace_ring(const char *name)
+{
+	static __thread t_trace_ring	*ring;
+	t_tracer						*t;
+	int								slot;
+
+	if (ring)
+		return (ring);
+	t = tracer();
+	slot = __atomic_fetch_add(&t->count, 1, __ATOMIC_ACQ_REL);
+	if (slot >= TRACE_MAX_THREADS)
+		return (NULL);
+	ring = malloc(sizeof(t_trace_ring));
+	if (!ring)
+		return (NULL);
+	ft_memset(ring, 0, sizeof(t_trace_ring));
+	ring->name = name;
+	ring->tid = slot + 1;
+	__atomic_store_n(&t->rings[slot], ring, __ATOMIC_RELEASE);
+	return (ring);
+}
+
+void	trace_init(char *path)
+{
+	t_tracer	*t;
+
+	t = tracer();
+	t->epoch = get_time_us();
+	t->frame = -1;
+	t->path = path;
+	if (!t->path)
+		t->path = TRACE_DEFAULT_PATH;
+	pthread_mutex_init(&t->lock, NULL);
+	trace_ring("main");
+}
+
+void	trace_thread(const char *name)
+{
+	trace_ring(name);
+}
+
+/*
+** Spans opened from now on are tagged with frame; startup work before the
+** first frame carries -1.
+*/
+void	trace_frame(long frame)
+{
+	__atomic_store_n(&tracer()->frame, frame, __ATOMIC_RELAXED);
+}
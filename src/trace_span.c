@@ -0,0 +1,55 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   trace_span.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:42:45 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 00:42:45 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+void	trace_begin(const char *name)
+{
+	t_trace_ring	*ring;
+
+	ring = trace_ring("worker");
+	if (!ring)
+		return ;
+	if (ring->depth < TRACE_MAX_DEPTH)
+		ring->open[ring->depth] = (t_trace_event){name, get_time_us(), 0,
+			__atomic_load_n(&tracer()->frame, __ATOMIC_RELAXED)};
+	ring->depth++;
+}
+
+/*
+** Closes the innermost span and publishes it. A full ring drops the
+** event rather than block the traced thread.
+*/
+void	trace_end(void)
+{
+	t_trace_ring	*ring;
+	t_trace_event	*event;
+	unsigned long	head;
+
+	ring = trace_ring("worker");
+	if (!ring || ring->depth == 0)
+		return ;
+	ring->depth--;
+	if (ring->depth >= TRACE_MAX_DEPTH)
+		return ;
+	head = ring->head;
+	if (head - __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE)
+		>= TRACE_RING_SIZE)
+	{
+		ring->dropped++;
+		return ;
+	}
+	event = &ring->events[head % TRACE_RING_SIZE];
+	*event = ring->open[ring->depth];
+	event->dur = get_time_us() - event->start;
+	__atomic_store_n(&ring->head, head + 1, __ATOMIC_RELEASE);
+}
@@ -0,0 +1,109 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   trace_write.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:42:45 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 00:42:45 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+static void	trace_separator(t_tracer *t)
+{
+	if (t->written++ > 0)
+		fputs(",\n", t->out);
+}
+
+static void	trace_write_ring(t_tracer *t, t_trace_ring *ring)
+{
+	t_trace_event	*event;
+	unsigned long	head;
+	unsigned long	tail;
+
+	head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+	tail = ring->tail;
+	while (tail < head)
+	{
+		event = &ring->events[tail % TRACE_RING_SIZE];
+		trace_separator(t);
+		fprintf(t->out, "{\"name\":\"%s\",\"cat\":\"cub3d\",\"ph\":\"X\","
+			"\"pid\":1,\"tid\":%d,\"ts\":%ld,\"dur\":%ld,"
+			"\"args\":{\"frame\":%ld}}", event->name, ring->tid,
+			event->start - t->epoch, event->dur, event->frame);
+		tail++;
+	}
+	__atomic_store_n(&ring->tail, tail, __ATOMIC_RELEASE);
+}
+
+/*
+** Metadata event naming the ring's thread in the timeline, with the count
+** of spans lost to a full ring.
+*/
+static void	trace_write_name(t_tracer *t, t_trace_ring *ring)
+{
+	trace_separator(t);
+	fprintf(t->out, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,"
+		"\"tid\":%d,\"args\":{\"name\":\"%s\",\"dropped\":%lu}}",
+		ring->tid, ring->name, ring->dropped);
+}
+
+/*
+** Drains every ring into the trace file. The file is a Chrome/Perfetto
+** JSON array that stays open until trace_shutdown, so repeated dumps from
+** the hotkey append rather than overwrite.
+*/
+void	trace_dump(void)
+{
+	t_tracer		*t;
+	t_trace_ring	*ring;
+	int				i;
+
+	t = tracer();
+	pthread_mutex_lock(&t->lock);
+	if (!t->out)
+	{
+		t->out = fopen(t->path, "w");
+		if (t->out)
+			fputs("[\n", t->out);
+	}
+	i = -1;
+	while (t->out && ++i < TRACE_MAX_THREADS)
+	{
+		ring = __atomic_load_n(&t->rings[i], __ATOMIC_ACQUIRE);
+		if (ring)
+			trace_write_ring(t, ring);
+	}
+	if (t->out)
+		fflush(t->out);
+	pthread_mutex_unlock(&t->lock);
+}
+
+void	trace_shutdown(void)
+{
+	t_tracer		*t;
+	t_trace_ring	*ring;
+	int				i;
+
+	trace_dump();
+	t = tracer();
+	i = -1;
+	while (++i < TRACE_MAX_THREADS)
+	{
+		ring = t->rings[i];
+		if (!ring)
+			continue ;
+		if (t->out)
+			trace_write_name(t, ring);
+		free(ring);
+		t->rings[i] = NULL;
+	}
+	if (t->out)
+		fputs("\n]\n", t->out);
+	if (t->out && fclose(t->out) == 0)
+		printf("[trace] wrote %d events to %s\n", t->written, t->path);
+	t->out = NULL;
+}
@@ -0,0 +1,143 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   xpm.c                                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:24:39 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 00:49:38 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+static int	xpm_parse_header(t_xpm *xpm)
+{
+	char	*line;
+
+	line = xpm_next_string(xpm);
+	if (!line || ft_sscanf(line, "%d %d %d %d", &xpm->width, &xpm->height,
+			&xpm->ncolors, &xpm->cpp) != 4)
+		return (-1);
+	if (xpm->width <= 0 || xpm->height <= 0 || xpm->ncolors <= 0
+		|| xpm->cpp <= 0 || xpm->cpp > XPM_MAX_CPP)
+		return (-1);
+	xpm->mask = 1;
+	while (xpm->mask < (unsigned long)xpm->ncolors * 2)
+		xpm->mask <<= 1;
+	xpm->keys = ft_calloc(xpm->mask, sizeof(unsigned long));
+	xpm->slots = ft_calloc(xpm->mask, sizeof(int));
+	xpm->palette = ft_calloc(xpm->ncolors, sizeof(unsigned int));
+	xpm->mask--;
+	if (!xpm->keys || !xpm->slots || !xpm->palette)
+		return (-1);
+	return (0);
+}
+
+static int	xpm_parse_colors(t_xpm *xpm)
+{
+	char	*line;
+	int		i;
+
+	i = 0;
+	while (i < xpm->ncolors)
+	{
+		line = xpm_next_string(xpm);
+		if (!line || (int)ft_strlen(line) < xpm->cpp)
+			return (-1);
+		if (xpm_color(line + xpm->cpp, &xpm->palette[i]) < 0)
+			return (-1);
+		xpm_insert(xpm, xpm_key(line, xpm->cpp), i);
+		i++;
+	}
+	return (0);
+}
+
+static int	xpm_parse_pixels(t_xpm *xpm, t_tex_source *texture)
+{
+	char	*line;
+	int		x;
+	int		y;
+	int		index;
+
+	y = -1;
+	while (++y < xpm->height)
+	{
+		line = xpm_next_string(xpm);
+		if (!line || (int)ft_strlen(line) < xpm->width * xpm->cpp)
+			return (-1);
+		x = -1;
+		while (++x < xpm->width)
+		{
+			index = xpm_lookup(xpm, xpm_key(line + x * xpm->cpp, xpm->cpp));
+			if (index < 0)
+				return (-1);
+			if (texture->indices)
+				texture->indices[y * xpm->width + x] = index;
+			else
+				((unsigned int *)texture->heap)[y * xpm->width + x]
+					= xpm->palette[index];
+		}
+	}
+	return (0);
+}
+
+static int	xpm_alloc_target(t_xpm *xpm, t_tex_source *texture)
+{
+	size_t	texels;
+
+	texels = (size_t)xpm->width * xpm->height;
+	texture->width = xpm->width;
+	texture->height = xpm->height;
+	if (xpm->ncolors > TEX_PALETTE_SIZE)
+	{
+		texture->heap = malloc(texels * sizeof(unsigned int));
+		texture->img = (t_image){NULL, texture->heap, 32, xpm->width * 4, 0};
+		return (-(texture->heap == NULL));
+	}
+	texture->heap = ft_calloc(1, TEX_PALETTE_SIZE * sizeof(unsigned int)
+			+ texels);
+	if (!texture->heap)
+		return (-1);
+	texture->colors = xpm->ncolors;
+	texture->palette = texture->heap;
+	texture->indices = (unsigned char *)(texture->palette + TEX_PALETTE_SIZE);
+	ft_memcpy(texture->palette, xpm->palette,
+		xpm->ncolors * sizeof(unsigned int));
+	return (0);
+}
+
+/*
+** Decodes an XPM file into a heap buffer without going through MLX, so
+** textures can be decoded off the main thread before the display
+** connection exists. Low-color images come out palettized.
+*/
+int	xpm_decode(t_tex_source *texture, const char *path)
+{
+	t_xpm	xpm;
+	int		status;
+	size_t	len;
+
+	ft_memset(&xpm, 0, sizeof(t_xpm));
+	xpm.data = xpm_read_file(path, &len);
+	if (xpm.data)
+		mem_account(MEM_TEXTURES, len);
+	xpm.cursor = xpm.data;
+	status = -1;
+	if (xpm.data && xpm_parse_header(&xpm) == 0
+		&& xpm_parse_colors(&xpm) == 0 && xpm_alloc_target(&xpm, texture) == 0)
+		status = xpm_parse_pixels(&xpm, texture);
+	if (xpm.data)
+		mem_account(MEM_TEXTURES, -(long)len);
+	free(xpm.data);
+	free(xpm.keys);
+	free(xpm.slots);
+	free(xpm.palette);
+	if (status < 0)
+	{
+		free(texture->heap);
+		ft_memset(texture, 0, sizeof(t_tex_source));
+	}
+	return (status);
+}
@@ -0,0 +1,87 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   xpm_color.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:24:39 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 02:43:51 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+static int	hex_value(char c)
+{
+	if (c >= '0' && c <= '9')
+		return (c - '0');
+	if (c >= 'a' && c <= 'f')
+		return (c - 'a' + 10);
+	if (c >= 'A' && c <= 'F')
+		return (c - 'A' + 10);
+	return (-1);
+}
+
+static int	parse_hex_color(const char *s, unsigned int *color)
+{
+	unsigned long	value;
+	int				digits;
+
+	value = 0;
+	digits = 0;
+	while (hex_value(s[digits]) >= 0)
+		value = (value << 4) | hex_value(s[digits++]);
+	if (digits == 3)
+		*color = (value >> 8 & 0xF) * 0x110000 + (value >> 4 & 0xF) * 0x1100
+			+ (value & 0xF) * 0x11;
+	else if (digits == 6)
+		*color = value;
+	else if (digits == 12)
+		*color = (value >> 24 & 0xFF0000) | (value >> 16 & 0xFF00)
+			| (value >> 8 & 0xFF);
+	else
+		return (-1);
+	return (0);
+}
+
+static const char	*find_color_value(const char *s)
+{
+	while (*s)
+	{
+		while (*s == ' ' || *s == '\t')
+			s++;
+		if (s[0] == 'c' && (s[1] == ' ' || s[1] == '\t'))
+		{
+			s++;
+			while (*s == ' ' || *s == '\t')
+				s++;
+			return (s);
+		}
+		while (*s && *s != ' ' && *s != '\t')
+			s++;
+	}
+	return (NULL);
+}
+
+/*
+** Only the "c" (color visual) key is read, as #rgb hex or an X11 color
+** name. Transparent pixels use the same 0xFF000000 marker MLX produces
+** for "None".
+*/
+int	xpm_color(const char *spec, unsigned int *color)
+{
+	const char	*value;
+
+	value = find_color_value(spec);
+	if (!value)
+		return (-1);
+	if (*value == '#')
+		return (parse_hex_color(value + 1, color));
+	if (ft_strncmp(value, "None", 4) == 0 || ft_strncmp(value, "none", 4) == 0)
+	{
+		*color = 0xFF000000;
+		return (0);
+	}
+	return (xpm_color_name(value, color));
+}
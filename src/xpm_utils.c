@@ -0,0 +1,99 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   xpm_utils.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:24:39 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 00:49:38 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+#include <sys/stat.h>
+
+char	*xpm_read_file(const char *path, size_t *len)
+{
+	int			fd;
+	struct stat	st;
+	char		*data;
+	ssize_t		got;
+
+	fd = open(path, O_RDONLY);
+	if (fd < 0)
+		return (NULL);
+	data = NULL;
+	if (fstat(fd, &st) == 0)
+		data = malloc(st.st_size + 1);
+	*len = 0;
+	while (data && *len < (size_t)st.st_size)
+	{
+		got = read(fd, data + *len, st.st_size - *len);
+		if (got <= 0)
+			break ;
+		*len += got;
+	}
+	close(fd);
+	if (!data || *len != (size_t)st.st_size)
+		return (free(data), NULL);
+	data[*len] = '\0';
+	*len += 1;
+	return (data);
+}
+
+char	*xpm_next_string(t_xpm *xpm)
+{
+	char	*start;
+	char	*end;
+
+	start = ft_strchr(xpm->cursor, '"');
+	if (!start)
+		return (NULL);
+	end = ft_strchr(start + 1, '"');
+	if (!end)
+		return (NULL);
+	*end = '\0';
+	xpm->cursor = end + 1;
+	return (start + 1);
+}
+
+unsigned long	xpm_key(const char *s, int cpp)
+{
+	unsigned long	key;
+	int				i;
+
+	key = 0;
+	i = 0;
+	while (i < cpp)
+	{
+		key = (key << 8) | (unsigned char)s[i];
+		i++;
+	}
+	return (key);
+}
+
+void	xpm_insert(t_xpm *xpm, unsigned long key, int index)
+{
+	unsigned long	slot;
+
+	slot = (key * 11400714819323198485UL >> 32) & xpm->mask;
+	while (xpm->keys[slot] && xpm->keys[slot] != key)
+		slot = (slot + 1) & xpm->mask;
+	xpm->keys[slot] = key;
+	xpm->slots[slot] = index;
+}
+
+int	xpm_lookup(t_xpm *xpm, unsigned long key)
+{
+	unsigned long	slot;
+
+	slot = (key * 11400714819323198485UL >> 32) & xpm->mask;
+	while (xpm->keys[slot])
+	{
+		if (xpm->keys[slot] == key)
+			return (xpm->slots[slot]);
+		slot = (slot + 1) & xpm->mask;
+	}
+	return (-1);
+}
@@ -0,0 +1,89 @@
+#!/bin/bash
+
+GREEN="\033[1;32m"
+RED="\033[1;31m"
+NC="\033[0m" # No color
+
+BIN=${BIN:-./build/cub3D}
+OUT=${OUT:-build/bench.json}
+GOLDEN=${GOLDEN:-bench/golden.txt}
+PATHS=(sweep corridor hug)
+
+show_usage() {
+    echo -e "${GREEN}Usage:${NC} tools/bench.sh [--update]"
+    echo
+    echo "Plays each fly-through path (${PATHS[*]}) on every map in"
+    echo "maps/valid/ with --headless --fps 0 and writes the per-stage"
+    echo "frame times to \$OUT ($OUT) as a JSON array."
+    echo
+    echo "Every frame of a run is folded into one run hash, compared with"
+    echo "\$GOLDEN ($GOLDEN). A mismatch means the rendered output of some"
+    echo "frame changed and makes the script exit 1."
+    echo
+    echo "  --update   : Rewrite \$GOLDEN from this run instead of comparing."
+    echo
+}
+
+update=0
+if [[ $1 == "--update" ]]; then
+    update=1
+elif [[ $# -gt 0 ]]; then
+    show_usage
+    exit 0
+fi
+
+tmp=$(mktemp -d)
+trap 'rm -rf "$tmp"' EXIT
+mismatches=0
+first=1
+
+mkdir -p "$(dirname "$OUT")"
+echo "[" > "$OUT"
+[[ $update -eq 1 ]] && : > "$tmp/golden"
+
+for map in maps/valid/*.cub; do
+    for path in "${PATHS[@]}"; do
+        report="$tmp/run.json"
+        rm -f "$report"
+        if ! "$BIN" --headless --fps 0 --tick-rate 30 --path "$path" \
+            --report "$report" "$map" > /dev/null 2>&1 || [[ ! -f $report ]]; then
+            printf "%-40s %-10s ${RED}%s${NC}\n" "$map" "$path" "FAILED"
+            mismatches=$((mismatches + 1))
+            continue
+        fi
+        hash=$(sed -n 's/.*"run_hash": "\([0-9a-f]*\)".*/\1/p' "$report")
+        expected=$(awk -v m="$map" -v p="$path" \
+            '$1 == m && $2 == p { print $3 }' "$GOLDEN" 2>/dev/null)
+        if [[ $update -eq 1 ]]; then
+            echo "$map $path $hash" >> "$tmp/golden"
+            status="updated"
+        elif [[ -z $expected ]]; then
+            status="new"
+        elif [[ $expected == "$hash" ]]; then
+            status="match"
+        else
+            status="mismatch"
+            mismatches=$((mismatches + 1))
+        fi
+        color=$GREEN
+        [[ $status == "mismatch" ]] && color=$RED
+        printf "%-40s %-10s ${color}%s${NC}\n" "$map" "$path" "$status"
+        [[ $first -eq 0 ]] && echo "," >> "$OUT"
+        first=0
+        echo "{\"golden\": \"$status\", \"run\":" >> "$OUT"
+        cat "$report" >> "$OUT"
+        echo "}" >> "$OUT"
+    done
+done
+
+echo "]" >> "$OUT"
+if [[ $update -eq 1 ]]; then
+    mkdir -p "$(dirname "$GOLDEN")"
+    mv "$tmp/golden" "$GOLDEN"
+    echo -e "${GREEN}Golden hashes written to $GOLDEN${NC}"
+fi
+echo "Results written to $OUT"
+if [[ $mismatches -gt 0 ]]; then
+    echo -e "${RED}$mismatches run(s) failed or changed output${NC}"
+    exit 1
+fi
@@ -0,0 +1,98 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cub3d_embed.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:44:46 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 02:27:34 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d_api.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+static unsigned long	hash_frame(const t_cub3d_frame *frame)
+{
+	unsigned long	hash;
+	int				i;
+
+	hash = 0xCBF29CE484222325UL;
+	i = 0;
+	while (i < frame->stride * frame->height)
+		hash = (hash ^ frame->pixels[i++]) * 0x100000001B3UL;
+	return (hash);
+}
+
+static int	fail(const char *what)
+{
+	fprintf(stderr, "cub3d_embed: %s: %s\n", what, cub3d_error());
+	return (1);
+}
+
+/* Engine log lines go to stderr, so stdout only carries the results */
+static void	log_to_stderr(const char *line, void *user)
+{
+	fprintf(stderr, "%s: %s\n", (const char *)user, line);
+}
+
+/*
+** Walks forward for ticks, renders, and prints the pose, the wall distance
+** in the middle column and the frame hash
+*/
+static int	walk(t_cub3d *world, int ticks, unsigned long *hash)
+{
+	static unsigned int	pixels[128 * 128];
+	static float		depth[128];
+	t_cub3d_frame		frame;
+	t_cub3d_columns		columns;
+	t_cub3d_pose		pose;
+
+	frame = (t_cub3d_frame){pixels, 128, 128, 128};
+	columns = (t_cub3d_columns){depth, NULL, NULL};
+	if (cub3d_set_keys(world, CUB3D_KEY_W) < 0
+		|| cub3d_step(world, ticks) < 0
+		|| cub3d_get_camera(world, &pose) < 0
+		|| cub3d_render_columns(world, &frame, &columns) < 0)
+		return (-1);
+	*hash = hash_frame(&frame);
+	printf("pose %.4f %.4f dir %.4f %.4f depth %.4f frame %016lx\n",
+		pose.x, pose.y, pose.dir_x, pose.dir_y, depth[64], *hash);
+	return (0);
+}
+
+/*
+** Usage: cub3d_embed map.cub [ticks]. Walks from the spawn twice, the
+** second time from a snapshot taken right after loading, and exits 1 if
+** the two runs do not end on the same frame.
+*/
+int	main(int argc, char **argv)
+{
+	t_cub3d			*world;
+	unsigned char	*snap;
+	unsigned long	hash[2];
+	int				ticks;
+
+	if (argc < 2)
+		return (fprintf(stderr, "Usage: %s map.cub [ticks]\n", argv[0]), 2);
+	cub3d_set_log(log_to_stderr, argv[0]);
+	world = cub3d_load(argv[1]);
+	if (!world)
+		return (fail(argv[1]));
+	ticks = 30;
+	if (argc > 2)
+		ticks = atoi(argv[2]);
+	snap = malloc(cub3d_snapshot_size());
+	if (!snap || cub3d_snapshot(world, snap, cub3d_snapshot_size()) < 0
+		|| walk(world, ticks, &hash[0]) < 0
+		|| cub3d_restore(world, snap, cub3d_snapshot_size()) < 0
+		|| walk(world, ticks, &hash[1]) < 0)
+		return (free(snap), cub3d_destroy(world), fail("run"));
+	free(snap);
+	cub3d_destroy(world);
+	if (hash[0] != hash[1])
+		return (fprintf(stderr, "cub3d_embed: restore diverged\n"), 1);
+	return (0);
+}
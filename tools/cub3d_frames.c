@@ -0,0 +1,128 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cub3d_frames.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:54:29 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 01:54:29 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "frame_shm.h"
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <time.h>
+#include <unistd.h>
+
+/* Maps the header first to learn the ring size, then the whole ring */
+static t_ring_page	*map_ring(void)
+{
+	t_ring_page	*page;
+	size_t		size;
+	int			fd;
+
+	fd = shm_open(FRAME_SHM_NAME, O_RDWR, 0);
+	if (fd < 0)
+		return (NULL);
+	page = mmap(NULL, sizeof(t_ring_page), PROT_READ, MAP_SHARED, fd, 0);
+	if (page == MAP_FAILED || page->magic != FRAME_SHM_MAGIC
+		|| page->version != FRAME_SHM_VERSION)
+		return (close(fd), NULL);
+	size = sizeof(t_ring_page) + page->slots * page->slot_size;
+	munmap(page, sizeof(t_ring_page));
+	page = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd);
+	if (page == MAP_FAILED)
+		return (NULL);
+	return (page);
+}
+
+static long	now_us(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * 1000000 + ts.tv_nsec / 1000);
+}
+
+/* Reads the pixels where they are, FNV-1a like the engine's frame_hash */
+static void	print_slot(const t_ring_page *ring, const t_ring_slot *slot)
+{
+	const unsigned char	*row;
+	unsigned long		hash;
+	int					x;
+	int					y;
+
+	hash = 0xCBF29CE484222325UL;
+	y = -1;
+	while (++y < ring->height)
+	{
+		row = (const unsigned char *)(slot + 1) + (size_t)y * ring->stride;
+		x = 0;
+		while (x < ring->width * 4)
+			hash = (hash ^ row[x++]) * 0x100000001B3UL;
+	}
+	printf("frame %6lu  age %7.3f ms  pos %7.3f %7.3f  dir %6.3f %6.3f  "
+		"%016lx\n", slot->frame, (now_us() - slot->time_us) / 1000.0,
+		slot->x, slot->y, slot->dir_x, slot->dir_y, hash);
+	fflush(stdout);
+}
+
+/*
+** Consumer side: a slot is owned from the moment head passes it until
+** tail is released past it, so it is read in place with no copy.
+*/
+static unsigned long	consume(t_ring_page *ring, unsigned long count)
+{
+	unsigned long	tail;
+	unsigned long	read;
+
+	tail = ring->tail;
+	read = 0;
+	while (count == 0 || read < count)
+	{
+		if (tail == __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE))
+		{
+			usleep(1000);
+			continue ;
+		}
+		print_slot(ring, (const t_ring_slot *)((const char *)(ring + 1)
+				+ (tail % ring->slots) * ring->slot_size));
+		__atomic_store_n(&ring->tail, ++tail, __ATOMIC_RELEASE);
+		read++;
+	}
+	return (read);
+}
+
+/*
+** Usage: cub3d_frames [count]. Skips frames already waiting, then prints
+** a line for each new frame until count frames were read, or forever.
+*/
+int	main(int argc, char **argv)
+{
+	t_ring_page		*ring;
+	unsigned long	dropped;
+	unsigned long	read;
+
+	ring = map_ring();
+	if (!ring)
+	{
+		fprintf(stderr, "cub3d_frames: no engine publishing %s "
+			"(run cub3D with --frame-ring N)\n", FRAME_SHM_NAME);
+		return (1);
+	}
+	__atomic_store_n(&ring->tail, __atomic_load_n(&ring->head,
+			__ATOMIC_ACQUIRE), __ATOMIC_RELEASE);
+	dropped = __atomic_load_n(&ring->dropped, __ATOMIC_RELAXED);
+	read = 0;
+	if (argc > 1)
+		read = strtoul(argv[1], NULL, 10);
+	read = consume(ring, read);
+	printf("%lu frames read, %lu dropped by the engine meanwhile\n", read,
+		__atomic_load_n(&ring->dropped, __ATOMIC_RELAXED) - dropped);
+	return (0);
+}
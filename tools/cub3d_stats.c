@@ -0,0 +1,103 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cub3d_stats.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:45:48 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 00:45:48 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "stats_shm.h"
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+/*
+** Seqlock reader: retries while the engine is mid-write or wrote during
+** the copy.
+*/
+static void	read_page(const t_stats_page *page, t_stats_page *out)
+{
+	unsigned long	before;
+	unsigned long	after;
+
+	while (1)
+	{
+		before = __atomic_load_n(&page->seq, __ATOMIC_ACQUIRE);
+		if (before & 1)
+			continue ;
+		memcpy(out, page, sizeof(t_stats_page));
+		__atomic_thread_fence(__ATOMIC_ACQUIRE);
+		after = __atomic_load_n(&page->seq, __ATOMIC_RELAXED);
+		if (before == after)
+			return ;
+	}
+}
+
+static void	print_page(const t_stats_page *s)
+{
+	printf("pid %d frame %lu frame_ms %.3f present_ms %.3f\n", s->pid,
+		s->frame, s->frame_ms, s->present_ms);
+	printf("  dda_steps  %12lu  total %lu\n", s->last[STAT_DDA_STEPS],
+		s->total[STAT_DDA_STEPS]);
+	printf("  texels     %12lu  total %lu\n", s->last[STAT_TEXELS],
+		s->total[STAT_TEXELS]);
+	printf("  pixels     %12lu  total %lu\n", s->last[STAT_PIXELS],
+		s->total[STAT_PIXELS]);
+	printf("  ray_steps  %12lu  total %lu\n", s->last[STAT_RAY_STEPS],
+		s->total[STAT_RAY_STEPS]);
+	fflush(stdout);
+}
+
+static const t_stats_page	*map_page(void)
+{
+	const t_stats_page	*page;
+	int					fd;
+
+	fd = shm_open(STATS_SHM_NAME, O_RDONLY, 0);
+	if (fd < 0)
+		return (NULL);
+	page = mmap(NULL, sizeof(t_stats_page), PROT_READ, MAP_SHARED, fd, 0);
+	close(fd);
+	if (page == MAP_FAILED || page->magic != STATS_SHM_MAGIC
+		|| page->version != STATS_SHM_VERSION)
+		return (NULL);
+	return (page);
+}
+
+/*
+** Usage: cub3d_stats [interval_ms]. Prints the page once, or every
+** interval_ms until interrupted.
+*/
+int	main(int argc, char **argv)
+{
+	const t_stats_page	*page;
+	t_stats_page		snapshot;
+	int					interval;
+
+	page = map_page();
+	if (!page)
+	{
+		fprintf(stderr, "cub3d_stats: no engine publishing %s "
+			"(run cub3D with --stats)\n", STATS_SHM_NAME);
+		return (1);
+	}
+	interval = 0;
+	if (argc > 1)
+		interval = atoi(argv[1]);
+	read_page(page, &snapshot);
+	print_page(&snapshot);
+	while (interval > 0)
+	{
+		usleep(interval * 1000);
+		read_page(page, &snapshot);
+		print_page(&snapshot);
+	}
+	return (0);
+}
@@ -0,0 +1,113 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_bench.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:54:42 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 00:54:42 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libgc.h"
+#include <stdio.h>
+#include <time.h>
+
+static long	now_ns(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * 1000000000L + ts.tv_nsec);
+}
+
+/*
+** Fixed xorshift shuffle, so every run frees in the same scattered order
+** and neither end of the tracker gets an unfair advantage.
+*/
+static void	shuffle(void **ptrs, size_t n)
+{
+	unsigned long	state;
+	size_t			i;
+	size_t			j;
+	void			*tmp;
+
+	state = 0x9E3779B97F4A7C15UL;
+	i = n;
+	while (i > 1)
+	{
+		state ^= state << 13;
+		state ^= state >> 7;
+		state ^= state << 17;
+		j = state % i--;
+		tmp = ptrs[i];
+		ptrs[i] = ptrs[j];
+		ptrs[j] = tmp;
+	}
+}
+
+/* Mean cost of one gc_free with n blocks tracked, in nanoseconds */
+static double	bench_free(size_t n)
+{
+	void	**ptrs;
+	size_t	i;
+	long	start;
+	long	elapsed;
+
+	ptrs = malloc(n * sizeof(void *));
+	i = 0;
+	while (ptrs && i < n)
+	{
+		ptrs[i] = gc_malloc(32);
+		if (!ptrs[i++])
+			return (free(ptrs), -1);
+	}
+	if (!ptrs)
+		return (-1);
+	shuffle(ptrs, n);
+	start = now_ns();
+	i = 0;
+	while (i < n)
+		gc_free(ptrs[i++]);
+	elapsed = now_ns() - start;
+	free(ptrs);
+	return ((double)elapsed / n);
+}
+
+static void	print_row(size_t n, double ns, double previous)
+{
+	if (previous > 0)
+		printf("%10zu %12.1f %7.1fx\n", n, ns, ns / previous);
+	else
+		printf("%10zu %12.1f %8s\n", n, ns, "-");
+}
+
+/*
+** Tracks 1000, 10000 and 100000 blocks and frees them all. A
+** constant-time tracker keeps ns/free flat, a linear one grows about 10x
+** per row.
+*/
+int	main(void)
+{
+	size_t	n;
+	double	ns;
+	double	previous;
+
+	if (gc_init() != 0)
+		return (1);
+	printf("%10s %12s %8s\n", "blocks", "ns/free", "growth");
+	n = 1000;
+	previous = 0;
+	while (n <= 100000)
+	{
+		ns = bench_free(n);
+		if (ns < 0 || gc_count() != 0)
+			return (gc_clean(), fprintf(stderr, "gc_bench: failed\n"), 1);
+		print_row(n, ns, previous);
+		previous = ns;
+		n *= 10;
+	}
+	gc_clean();
+	return (0);
+}
@@ -0,0 +1,97 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   microbench.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:27:14 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 01:50:17 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "microbench.h"
+#include <time.h>
+
+static long	now_ns(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * 1000000000L + ts.tv_nsec);
+}
+
+/*
+** BENCH_WARMUP untimed repetitions fault in the data and train the
+** branch predictors, then BENCH_REPS timed ones are summarized per unit.
+*/
+void	bench_run(t_bench *bench, t_bench_fn fn, t_game *game, void *ctx)
+{
+	long				times[BENCH_REPS];
+	long				start;
+	t_timing_summary	sum;
+	int					i;
+
+	i = -BENCH_WARMUP;
+	while (i < BENCH_REPS)
+	{
+		start = now_ns();
+		fn(game, ctx);
+		if (i >= 0)
+			times[i] = now_ns() - start;
+		i++;
+	}
+	if (summarize_timings(times, BENCH_REPS, 1, &sum) < 0)
+		return ;
+	printf("%-20s %-18s %-6s %9.2f %9.2f %9.2f %9.2f %9.2f\n",
+		bench->kernel, bench->label, bench->unit, sum.mean / bench->units,
+		(double)sum.min / bench->units, (double)sum.p50 / bench->units,
+		(double)sum.p99 / bench->units, (double)sum.max / bench->units);
+}
+
+static void	run_all(t_game *game)
+{
+	static const int	maps[4][2] = {{16, 10}, {64, 10}, {64, 40},
+	{256, 2}};
+	static const int	heights[5] = {HEIGHT / 8, HEIGHT / 2, HEIGHT,
+		HEIGHT * 2, HEIGHT * 8};
+	int					i;
+
+	i = -1;
+	while (++i < 4)
+		bench_dda(game, maps[i][0], maps[i][1]);
+	i = -1;
+	while (++i < 5)
+		bench_wall(game, heights[i]);
+	i = -1;
+	while (++i < 3)
+		bench_texture(game, i);
+	bench_minimap_rays(game);
+	bench_batch(game, 0);
+	bench_batch(game, 1);
+}
+
+/*
+** Kernels run on the headless frame buffer against generated maps and
+** the stock textures, so run it from the repository root.
+*/
+int	main(void)
+{
+	t_game	game;
+
+	ft_memset(&game, 0, sizeof(t_game));
+	if (gc_init() != 0 || platform_headless()->open(&game) < 0)
+		return (1);
+	if (bench_textures(&game) < 0)
+	{
+		fprintf(stderr, "microbench: failed to load textures\n");
+		return (1);
+	}
+	printf("%-20s %-18s %-6s %9s %9s %9s %9s %9s\n", "kernel", "case",
+		"unit", "mean ns", "min ns", "p50 ns", "p99 ns", "max ns");
+	run_all(&game);
+	texmgr_destroy(&game.texmgr);
+	platform_headless()->close(&game);
+	gc_clean();
+	return (0);
+}
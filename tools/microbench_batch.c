@@ -0,0 +1,98 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   microbench_batch.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:37:55 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 01:50:17 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "microbench.h"
+
+static void	run_batch(t_game *game, void *ctx)
+{
+	render_batch(game, (t_batch *)ctx);
+}
+
+/* Random poses from walkable cells of the current map */
+static t_player	*batch_poses(t_game *game)
+{
+	t_player		*poses;
+	unsigned long	state;
+	int				i;
+
+	poses = malloc(sizeof(t_player) * BENCH_BATCH);
+	state = 0x2545F4914F6CDD1DUL;
+	i = -1;
+	while (poses && ++i < BENCH_BATCH)
+	{
+		bench_camera(game, &state);
+		poses[i] = game->camera;
+	}
+	return (poses);
+}
+
+/*
+** One block for the whole batch: frames packed back to back like small
+** window images, then the column outputs of every frame, in batch->aux.
+*/
+static char	*batch_frames(t_batch *batch)
+{
+	char	*mem;
+	char	*column;
+	size_t	frame;
+	int		i;
+
+	frame = (size_t)batch->width * batch->height * 4;
+	mem = malloc(batch->count * (frame + sizeof(t_aux)
+				+ batch->width * BENCH_AUX_BYTES));
+	if (!mem || !batch->frames)
+		return (free(mem), NULL);
+	batch->aux = (t_aux *)(mem + batch->count * frame);
+	column = (char *)(batch->aux + batch->count);
+	i = -1;
+	while (++i < batch->count)
+	{
+		batch->frames[i] = (t_image){NULL, mem + i * frame, 32,
+			batch->width * 4, 0};
+		batch->aux[i] = (t_aux){(float *)column, (unsigned char *)(column
+				+ batch->width * (BENCH_AUX_BYTES - 1)),
+			(int *)(column + batch->width * sizeof(float))};
+		column += batch->width * BENCH_AUX_BYTES;
+	}
+	return (mem);
+}
+
+/*
+** BENCH_BATCH random poses per render_batch call, in ns per frame, with
+** or without the depth, face and tile outputs.
+*/
+void	bench_batch(t_game *game, int with_aux)
+{
+	t_bench	bench;
+	t_batch	batch;
+	char	*mem;
+
+	if (bench_map(&game->config.map, 64, 10) < 0)
+		return ;
+	batch = (t_batch){batch_poses(game), ft_calloc(BENCH_BATCH,
+			sizeof(t_image)), BENCH_BATCH, BENCH_BATCH_SIZE, BENCH_BATCH_SIZE,
+		NULL};
+	mem = batch_frames(&batch);
+	bench = (t_bench){"render_batch", "", "frame", BENCH_BATCH};
+	snprintf(bench.label, sizeof(bench.label), "%d x %dx%d", BENCH_BATCH,
+		BENCH_BATCH_SIZE, BENCH_BATCH_SIZE);
+	if (with_aux)
+		ft_strlcat(bench.label, " +aux", sizeof(bench.label));
+	else
+		batch.aux = NULL;
+	if (batch.poses && mem)
+		bench_run(&bench, run_batch, game, &batch);
+	free((void *)batch.poses);
+	free(batch.frames);
+	free(mem);
+	bench_free_map(&game->config.map);
+}
@@ -0,0 +1,82 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   microbench_rays.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:28:07 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 01:39:20 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "microbench.h"
+
+static void	run_dda(t_game *game, void *ctx)
+{
+	t_ray_set	*set;
+	t_ray		ray;
+	long		i;
+
+	set = (t_ray_set *)ctx;
+	i = -1;
+	while (++i < set->count)
+	{
+		ray = set->rays[i];
+		perform_dda(game, &ray);
+	}
+}
+
+/*
+** Rays are set up ahead from a new random camera every WIDTH rays, so
+** the timed loop is perform_dda alone over the whole spread of lengths.
+*/
+void	bench_dda(t_game *game, int size, int density)
+{
+	t_bench			bench;
+	t_ray_set		set;
+	t_view			view;
+	unsigned long	state;
+
+	if (bench_map(&game->config.map, size, density) < 0)
+		return ;
+	set.rays = malloc(sizeof(t_ray) * BENCH_RAYS);
+	set.count = -1;
+	state = 0x2545F4914F6CDD1DUL;
+	while (set.rays && ++set.count < BENCH_RAYS)
+	{
+		if (set.count % WIDTH == 0)
+			bench_camera(game, &state);
+		view_init(&view, game, &game->img);
+		init_ray(&view, &set.rays[set.count], set.count % WIDTH);
+		calculate_step_and_side_dist(&view, &set.rays[set.count]);
+	}
+	bench = (t_bench){"perform_dda", "", "ray", BENCH_RAYS};
+	snprintf(bench.label, sizeof(bench.label), "%dx%d %d%%", size, size,
+		density);
+	if (set.rays)
+		bench_run(&bench, run_dda, game, &set);
+	free(set.rays);
+	bench_free_map(&game->config.map);
+}
+
+static void	run_minimap_rays(t_game *game, void *ctx)
+{
+	(void)ctx;
+	draw_minimap_rays(game);
+}
+
+/* draw_minimap_rays casts 1000 rays per call */
+void	bench_minimap_rays(t_game *game)
+{
+	t_bench			bench;
+	unsigned long	state;
+
+	if (bench_map(&game->config.map, 64, 10) < 0)
+		return ;
+	state = 0x2545F4914F6CDD1DUL;
+	bench_camera(game, &state);
+	bench = (t_bench){"draw_minimap_rays", "64x64 10%", "ray", 1000};
+	bench_run(&bench, run_minimap_rays, game, NULL);
+	bench_free_map(&game->config.map);
+}
@@ -0,0 +1,105 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   microbench_setup.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:27:14 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 01:44:46 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "microbench.h"
+#include <math.h>
+
+unsigned long	bench_rand(unsigned long *state)
+{
+	*state ^= *state << 13;
+	*state ^= *state >> 7;
+	*state ^= *state << 17;
+	return (*state);
+}
+
+/*
+** Square map with a solid border and interior walls on density percent
+** of the cells, the same map for the same size and density.
+*/
+int	bench_map(t_map *map, int size, int density)
+{
+	unsigned long	state;
+	int				x;
+	int				y;
+
+	state = 0x9E3779B97F4A7C15UL ^ ((unsigned long)size << 8 | density);
+	map->grid = ft_calloc(size + 1, sizeof(char *));
+	if (!map->grid)
+		return (-1);
+	map->width = size;
+	map->height = size;
+	y = -1;
+	while (++y < size)
+	{
+		map->grid[y] = malloc(size + 1);
+		if (!map->grid[y])
+			return (bench_free_map(map), -1);
+		ft_memset(map->grid[y], WALKABLE, size);
+		map->grid[y][size] = '\0';
+		x = size;
+		while (--x >= 0)
+			if (x == 0 || y == 0 || x == size - 1 || y == size - 1
+				|| (long)(bench_rand(&state) % 100) < density)
+				map->grid[y][x] = WALL;
+	}
+	return (0);
+}
+
+void	bench_free_map(t_map *map)
+{
+	int	y;
+
+	y = 0;
+	while (map->grid && map->grid[y])
+		free(map->grid[y++]);
+	free(map->grid);
+	map->grid = NULL;
+}
+
+/* Random walkable cell and view direction, plane kept at PLANE_DIST */
+void	bench_camera(t_game *game, unsigned long *state)
+{
+	t_map	*map;
+	int		x;
+	int		y;
+	double	angle;
+
+	map = &game->config.map;
+	x = 0;
+	y = 0;
+	while (map->grid[y][x] == WALL)
+	{
+		x = 1 + bench_rand(state) % (map->width - 2);
+		y = 1 + bench_rand(state) % (map->height - 2);
+	}
+	angle = (bench_rand(state) % 3600) * M_PI / 1800.0;
+	game->camera.x = x + 0.25 + (bench_rand(state) % 50) / 100.0;
+	game->camera.y = y + 0.25 + (bench_rand(state) % 50) / 100.0;
+	game->camera.dir_x = cos(angle);
+	game->camera.dir_y = sin(angle);
+	game->camera.plane_x = -game->camera.dir_y * PLANE_DIST;
+	game->camera.plane_y = game->camera.dir_x * PLANE_DIST;
+}
+
+/* Loads the stock wall textures through the texture manager */
+int	bench_textures(t_game *game)
+{
+	game->config.textures.north = "./textures/north.xpm";
+	game->config.textures.south = "./textures/south.xpm";
+	game->config.textures.west = "./textures/west.xpm";
+	game->config.textures.east = "./textures/east.xpm";
+	if (texmgr_init(&game->texmgr, TEXMGR_DEFAULT_BUDGET) < 0)
+		return (-1);
+	if (register_wall_textures(game) < 0)
+		return (-1);
+	return (wait_wall_textures(game));
+}
@@ -0,0 +1,125 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   microbench_texture.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ataher <ataher@student.42amman.com>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:27:14 by ataher            #+#    #+#             */
+/*   Updated: 2026/10/19 01:39:20 by ataher           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "microbench.h"
+
+static void	run_wall(t_game *game, void *ctx)
+{
+	t_wall_case	*wall;
+	t_ray		ray;
+	int			x;
+
+	(void)game;
+	wall = (t_wall_case *)ctx;
+	x = -1;
+	while (++x < WIDTH)
+	{
+		ray = wall->ray;
+		ray.side = x & 1;
+		draw_textured_wall(&wall->view, &ray, x);
+	}
+}
+
+/* One full screen of wall stripes, all line_height tall */
+void	bench_wall(t_game *game, int line_height)
+{
+	t_bench		bench;
+	t_wall_case	wall;
+
+	view_init(&wall.view, game, &game->img);
+	ft_memset(&wall.ray, 0, sizeof(t_ray));
+	wall.ray.ray_dir_x = 0.8;
+	wall.ray.ray_dir_y = 0.6;
+	wall.ray.perp_wall_dist = (double)HEIGHT / line_height;
+	wall.ray.line_height = line_height;
+	wall.ray.draw_start = -line_height / 2 + HEIGHT / 2;
+	if (wall.ray.draw_start < 0)
+		wall.ray.draw_start = 0;
+	wall.ray.draw_end = line_height / 2 + HEIGHT / 2;
+	if (wall.ray.draw_end >= HEIGHT)
+		wall.ray.draw_end = HEIGHT - 1;
+	bench = (t_bench){"draw_textured_wall", "", "pixel",
+		(long)(wall.ray.draw_end - wall.ray.draw_start) * WIDTH};
+	snprintf(bench.label, sizeof(bench.label), "height %d", line_height);
+	if (bench.units > 0)
+		bench_run(&bench, run_wall, game, &wall);
+}
+
+static void	run_samples(t_game *game, void *ctx)
+{
+	t_sample_set	*set;
+	unsigned int	sum;
+	long			i;
+
+	(void)game;
+	set = (t_sample_set *)ctx;
+	sum = 0;
+	i = -1;
+	while (++i < set->count)
+		sum += get_texture_color(set->texture, set->xs[i], set->ys[i]);
+	set->sink += sum;
+}
+
+/*
+** 0 walks rows like a floor span, 1 walks columns like a wall stripe,
+** 2 jumps to random texels.
+*/
+static void	sample_coords(t_sample_set *set, int pattern)
+{
+	unsigned long	state;
+	unsigned long	r;
+	int				w;
+	int				h;
+	long			i;
+
+	state = 0x2545F4914F6CDD1DUL;
+	w = set->texture->width;
+	h = set->texture->height;
+	i = -1;
+	while (++i < set->count)
+	{
+		r = bench_rand(&state);
+		set->xs[i] = r % w;
+		set->ys[i] = (r >> 32) % h;
+		if (pattern == 0)
+			set->xs[i] = i % w;
+		if (pattern == 0)
+			set->ys[i] = i / w % h;
+		if (pattern == 1)
+			set->xs[i] = i / h % w;
+		if (pattern == 1)
+			set->ys[i] = i % h;
+	}
+}
+
+void	bench_texture(t_game *game, int pattern)
+{
+	static const char	*names[3] = {"rows", "columns", "random"};
+	t_bench				bench;
+	t_sample_set		set;
+
+	set.texture = texmgr_get(&game->texmgr, game->wall_tex[NORTH]);
+	set.count = BENCH_SAMPLES;
+	set.sink = 0;
+	set.xs = malloc(sizeof(int) * set.count);
+	set.ys = malloc(sizeof(int) * set.count);
+	if (set.xs && set.ys)
+	{
+		sample_coords(&set, pattern);
+		bench = (t_bench){"get_texture_color", "", "pixel", set.count};
+		snprintf(bench.label, sizeof(bench.label), "%s %dx%d",
+			names[pattern], set.texture->width, set.texture->height);
+		bench_run(&bench, run_samples, game, &set);
+	}
+	free(set.xs);
+	free(set.ys);
+}